@@ -0,0 +1,65 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#define DT_DRV_COMPAT zmk_behavior_nice_view
+
+#include <zephyr/device.h>
+#include <drivers/behavior.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <dt-bindings/zmk/nice_view.h>
+#include <zmk/behavior.h>
+
+#include "../widgets/flush.h"
+
+#if DT_HAS_COMPAT_STATUS_OKAY(DT_DRV_COMPAT)
+
+static int on_keymap_binding_pressed(struct zmk_behavior_binding *binding,
+                                     struct zmk_behavior_binding_event event) {
+    switch (binding->param1) {
+    case NV_INV_TOG:
+        display_flush_set_inverted(!display_flush_is_inverted());
+        return ZMK_BEHAVIOR_OPAQUE;
+    case NV_INV_ON:
+        display_flush_set_inverted(true);
+        return ZMK_BEHAVIOR_OPAQUE;
+    case NV_INV_OFF:
+        display_flush_set_inverted(false);
+        return ZMK_BEHAVIOR_OPAQUE;
+    case NV_FLIP_TOG:
+        display_flush_set_flipped(!display_flush_is_flipped());
+        return ZMK_BEHAVIOR_OPAQUE;
+    case NV_FLIP_ON:
+        display_flush_set_flipped(true);
+        return ZMK_BEHAVIOR_OPAQUE;
+    case NV_FLIP_OFF:
+        display_flush_set_flipped(false);
+        return ZMK_BEHAVIOR_OPAQUE;
+    default:
+        LOG_ERR("Unknown nice!view command: %d", binding->param1);
+        return -ENOTSUP;
+    }
+}
+
+static int on_keymap_binding_released(struct zmk_behavior_binding *binding,
+                                      struct zmk_behavior_binding_event event) {
+    return ZMK_BEHAVIOR_OPAQUE;
+}
+
+/* Global so a split keyboard toggles the display on every half */
+static const struct behavior_driver_api behavior_nice_view_driver_api = {
+    .binding_pressed = on_keymap_binding_pressed,
+    .binding_released = on_keymap_binding_released,
+    .locality = BEHAVIOR_LOCALITY_GLOBAL,
+};
+
+BEHAVIOR_DT_INST_DEFINE(0, NULL, NULL, NULL, NULL, POST_KERNEL,
+                        CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &behavior_nice_view_driver_api);
+
+#endif /* DT_HAS_COMPAT_STATUS_OKAY(DT_DRV_COMPAT) */
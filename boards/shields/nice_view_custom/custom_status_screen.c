@@ -5,13 +5,39 @@
  *
  */
 
+#include "widgets/flush.h"
+#include "widgets/park.h"
 #include "widgets/status.h"
+#include "widgets/watchdog.h"
+
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/position_state_changed.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STATUS)
 static struct zmk_widget_status status_widget;
+static lv_obj_t *status_screen;
+static uint32_t display_ready_ms;
+
+/*
+ * Building the widget tree and drawing the first frame is left until the
+ * panel has taken the empty screen, by which time the keyboard is scanning
+ * and advertising; CONFIG_NICE_VIEW_WIDGET_INIT_DELAY_MS caps the wait. Runs
+ * on the display work queue like every other LVGL access.
+ */
+static void status_widget_init(void) {
+    zmk_widget_status_init(&status_widget, status_screen);
+    lv_obj_align(zmk_widget_status_obj(&status_widget), LV_ALIGN_TOP_LEFT, 0, 0);
+    display_ready_ms = k_uptime_get_32();
+    LOG_DBG("Status widgets ready %u ms after boot", display_ready_ms);
+}
+
+static void deferred_init_work_cb(struct k_work *work) { status_widget_init(); }
+
+static K_WORK_DELAYABLE_DEFINE(deferred_init_work, deferred_init_work_cb);
 #endif
 
 lv_obj_t *zmk_display_status_screen() {
@@ -19,10 +45,48 @@ lv_obj_t *zmk_display_status_screen() {
     lv_obj_t *screen;
     screen = lv_obj_create(NULL);
 
+    render_watchdog_init();
+    display_flush_init();
+
 #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STATUS)
-    zmk_widget_status_init(&status_widget, screen);
-    lv_obj_align(zmk_widget_status_obj(&status_widget), LV_ALIGN_TOP_LEFT, 0, 0);
+    status_screen = screen;
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK)
+    nice_view_park_init(screen);
+#endif
+    if (CONFIG_NICE_VIEW_WIDGET_INIT_DELAY_MS > 0) {
+        k_work_schedule_for_queue(zmk_display_work_q(), &deferred_init_work,
+                                  K_MSEC(CONFIG_NICE_VIEW_WIDGET_INIT_DELAY_MS));
+        display_flush_when_ready(&deferred_init_work);
+    } else {
+        status_widget_init();
+    }
 #endif
 
     return screen;
 }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_BOOT_TIMING)
+static bool first_press_seen;
+
+static int boot_timing_listener(const zmk_event_t *eh) {
+    const struct zmk_position_state_changed *ev = as_zmk_position_state_changed(eh);
+
+    if (ev == NULL || !ev->state || first_press_seen) {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    first_press_seen = true;
+    if (display_ready_ms == 0) {
+        LOG_INF("First key press %u ms after boot, status widgets not built yet",
+                k_uptime_get_32());
+    } else {
+        LOG_INF("First key press %u ms after boot, status widgets ready at %u ms",
+                k_uptime_get_32(), display_ready_ms);
+    }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(boot_timing, boot_timing_listener);
+ZMK_SUBSCRIPTION(boot_timing, zmk_position_state_changed);
+#endif
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Compress the slideshow art with the context-modelled arithmetic coder.
+
+Reads the 1bpp images from art.c and writes a C file defining
+`art_cm_slides[]` and `art_cm_count` (see widgets/art_cm.h). The coder is the
+one benchmarked by art_codecs.py; every slide is decoded again and checked
+before it is written.
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(__file__))
+
+from art_codecs import HEIGHT, WIDTH, cm_decode, cm_encode, load_art  # noqa: E402
+
+
+def c_array(name, data):
+    lines = [f"static const uint8_t {name}[] = {{"]
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join(f"0x{b:02x}," for b in data[i : i + 16]))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("-o", "--output", required=True, help="C file to write")
+    parser.add_argument("art", help="art.c to read the images from")
+    args = parser.parse_args()
+
+    images = load_art(args.art)
+    if not images:
+        sys.exit(f"{args.art}: no images found")
+
+    arrays = []
+    entries = []
+    raw_total = 0
+    stored_total = 0
+    for name, data in images:
+        packed = cm_encode(data)
+        if cm_decode(packed, len(data))[0] != data:
+            sys.exit(f"art_cm.py: {name} does not round-trip")
+
+        raw_total += len(data)
+        stored_total += len(packed)
+        arrays.append(c_array(f"{name}_cm", packed))
+        entries.append(
+            f"    {{.width = {WIDTH}, .height = {HEIGHT}, "
+            f".data_size = sizeof({name}_cm), .data = {name}_cm}},"
+        )
+
+    with open(args.output, "w") as f:
+        f.write("/* Generated by art_cm.py, do not edit */\n\n")
+        f.write('#include "art_cm.h"\n\n')
+        f.write("\n\n".join(arrays))
+        f.write("\n\nconst struct art_cm_slide art_cm_slides[] = {\n")
+        f.write("\n".join(entries))
+        f.write("\n};\n\nconst size_t art_cm_count = ARRAY_SIZE(art_cm_slides);\n")
+
+    print(f"art_cm.py: {len(images)} slides, {raw_total} bytes raw, {stored_total} bytes stored")
+
+
+if __name__ == "__main__":
+    main()
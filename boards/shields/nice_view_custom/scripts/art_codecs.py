@@ -0,0 +1,561 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Compare candidate compression formats over the slideshow art in widgets/art.c.
+
+Every codec is run per image, since each slide has to decode on its own, and
+every result is decoded again and checked against the original before it is
+counted. For each codec the report lists the stored size of the whole set,
+the ratio against the raw 1bpp layout, the decoder state it needs in RAM, and
+the number of decode steps per slide (tokens, runs or binary decisions), which
+is what the decode loop on the keyboard iterates over.
+"""
+
+import argparse
+import heapq
+import json
+import os
+import re
+import sys
+
+ART_C = os.path.join(os.path.dirname(__file__), "..", "widgets", "art.c")
+
+WIDTH = 140
+HEIGHT = 68
+STRIDE = (WIDTH + 7) // 8
+PALETTE_SIZE = 8
+
+
+def load_art(path):
+    with open(path, "rb") as f:
+        text = f.read().decode("ascii")
+
+    images = []
+    for match in re.finditer(r"uint8_t (\w+)_map\[\] = \{(.*?)\};", text, re.S):
+        values = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", match.group(2)))
+        data = values[PALETTE_SIZE:]
+        if len(data) != STRIDE * HEIGHT:
+            sys.exit(f"{match.group(1)}: expected {STRIDE * HEIGHT} bytes, found {len(data)}")
+        images.append((match.group(1), data))
+
+    return images
+
+
+def pixel(data, x, y):
+    if x < 0 or x >= WIDTH or y < 0:
+        return 0
+    return (data[y * STRIDE + x // 8] >> (7 - x % 8)) & 1
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.bits = 0
+
+    def write(self, value, count):
+        for i in reversed(range(count)):
+            self.acc = self.acc << 1 | (value >> i) & 1
+            self.bits += 1
+            if self.bits == 8:
+                self.out.append(self.acc)
+                self.acc = 0
+                self.bits = 0
+
+    def finish(self):
+        if self.bits:
+            self.out.append(self.acc << (8 - self.bits))
+        return bytes(self.out)
+
+
+class BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def read(self, count):
+        value = 0
+        for _ in range(count):
+            byte = self.data[self.pos // 8] if self.pos // 8 < len(self.data) else 0
+            value = value << 1 | (byte >> (7 - self.pos % 8)) & 1
+            self.pos += 1
+        return value
+
+
+# ---- PackBits -------------------------------------------------------------
+
+
+def packbits_encode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run > 1:
+            out += bytes([257 - run, data[i]])
+            i += run
+            continue
+
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def packbits_decode(data, size):
+    out = bytearray()
+    steps = 0
+    i = 0
+    while len(out) < size:
+        header = data[i] - 256 if data[i] > 127 else data[i]
+        i += 1
+        steps += 1
+        if header >= 0:
+            out += data[i : i + header + 1]
+            i += header + 1
+        elif header != -128:
+            out += bytes([data[i]]) * (1 - header)
+            i += 1
+    return bytes(out), steps
+
+
+# ---- heatshrink (LZSS) ----------------------------------------------------
+
+
+def heatshrink_encode(data, window, lookahead):
+    writer = BitWriter()
+    break_even = (1 + window + lookahead) // 8
+    max_len = 1 << lookahead
+    i = 0
+    while i < len(data):
+        best_len, best_off = 0, 0
+        for off in range(1, min(i, 1 << window) + 1):
+            n = 0
+            while n < max_len and i + n < len(data) and data[i + n - off] == data[i + n]:
+                n += 1
+            if n > best_len:
+                best_len, best_off = n, off
+        if best_len > break_even:
+            writer.write(0, 1)
+            writer.write(best_off - 1, window)
+            writer.write(best_len - 1, lookahead)
+            i += best_len
+        else:
+            writer.write(1, 1)
+            writer.write(data[i], 8)
+            i += 1
+    return writer.finish()
+
+
+def heatshrink_decode(data, size, window, lookahead):
+    reader = BitReader(data)
+    out = bytearray()
+    steps = 0
+    while len(out) < size:
+        steps += 1
+        if reader.read(1):
+            out.append(reader.read(8))
+        else:
+            off = reader.read(window) + 1
+            count = reader.read(lookahead) + 1
+            for _ in range(count):
+                out.append(out[-off])
+    return bytes(out), steps
+
+
+# ---- LZ4 block format -----------------------------------------------------
+
+
+def lz4_encode(data):
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    # The format requires the last match to start 12 bytes before the end
+    limit = len(data) - 12
+
+    def emit(literals, match_len, offset):
+        lit_len = len(literals)
+        token = min(lit_len, 15) << 4
+        if match_len is not None:
+            token |= min(match_len - 4, 15)
+        out.append(token)
+        if lit_len >= 15:
+            n = lit_len - 15
+            while n >= 255:
+                out.append(255)
+                n -= 255
+            out.append(n)
+        out.extend(literals)
+        if match_len is not None:
+            out.extend(offset.to_bytes(2, "little"))
+            if match_len - 4 >= 15:
+                n = match_len - 4 - 15
+                while n >= 255:
+                    out.append(255)
+                    n -= 255
+                out.append(n)
+
+    while i < limit:
+        key = data[i : i + 4]
+        candidate = table.get(key)
+        table[key] = i
+        if candidate is None or i - candidate > 0xFFFF:
+            i += 1
+            continue
+        n = 4
+        while i + n < len(data) - 5 and data[candidate + n] == data[i + n]:
+            n += 1
+        emit(data[anchor:i], n, i - candidate)
+        i += n
+        anchor = i
+    emit(data[anchor:], None, 0)
+    return bytes(out)
+
+
+def lz4_decode(data, size):
+    out = bytearray()
+    steps = 0
+    i = 0
+    while True:
+        steps += 1
+        token = data[i]
+        i += 1
+        lit_len = token >> 4
+        if lit_len == 15:
+            while True:
+                lit_len += data[i]
+                i += 1
+                if data[i - 1] != 255:
+                    break
+        out += data[i : i + lit_len]
+        i += lit_len
+        if i >= len(data):
+            break
+        offset = data[i] | data[i + 1] << 8
+        i += 2
+        match_len = (token & 15) + 4
+        if token & 15 == 15:
+            while True:
+                match_len += data[i]
+                i += 1
+                if data[i - 1] != 255:
+                    break
+        for _ in range(match_len):
+            out.append(out[-offset])
+    return bytes(out[:size]), steps
+
+
+# ---- Huffman-coded runs ---------------------------------------------------
+
+
+def row_runs(data):
+    """Alternating run lengths per row, starting with color 0 (the first run may be empty)."""
+    runs = []
+    for y in range(HEIGHT):
+        color, length = 0, 0
+        for x in range(WIDTH):
+            if pixel(data, x, y) == color:
+                length += 1
+            else:
+                runs.append((color, length))
+                color, length = 1 - color, 1
+        runs.append((color, length))
+    return runs
+
+
+def huffman_lengths(freq):
+    if len(freq) == 1:
+        return {next(iter(freq)): 1}
+    heap = [(f, i, [s]) for i, (s, f) in enumerate(sorted(freq.items()))]
+    heapq.heapify(heap)
+    lengths = dict.fromkeys(freq, 0)
+    counter = len(heap)
+    while len(heap) > 1:
+        fa, _, a = heapq.heappop(heap)
+        fb, _, b = heapq.heappop(heap)
+        for s in a + b:
+            lengths[s] += 1
+        heapq.heappush(heap, (fa + fb, counter, a + b))
+        counter += 1
+    return lengths
+
+
+def canonical_codes(lengths):
+    codes = {}
+    code = 0
+    prev = 0
+    for length, symbol in sorted((l, s) for s, l in lengths.items()):
+        code <<= length - prev
+        codes[symbol] = (code, length)
+        code += 1
+        prev = length
+    return codes
+
+
+class HuffmanRuns:
+    """Separate static tables for runs of each color, shared by the whole set like fax codes."""
+
+    def __init__(self, images):
+        freq = [{}, {}]
+        for _, data in images:
+            for color, length in row_runs(data):
+                freq[color][length] = freq[color].get(length, 0) + 1
+        self.codes = [canonical_codes(huffman_lengths(f)) for f in freq]
+
+    def table_size(self):
+        # Canonical tables: one symbol byte and one length byte per entry
+        return sum(2 * len(codes) for codes in self.codes)
+
+    def encode(self, data):
+        writer = BitWriter()
+        for color, length in row_runs(data):
+            code, bits = self.codes[color][length]
+            writer.write(code, bits)
+        return writer.finish()
+
+    def decode(self, data, size):
+        lookup = [{(bits, code): s for s, (code, bits) in codes.items()} for codes in self.codes]
+        reader = BitReader(data)
+        out = bytearray(size)
+        steps = 0
+        for y in range(HEIGHT):
+            x, color = 0, 0
+            while x < WIDTH:
+                code, bits = 0, 0
+                while (bits, code) not in lookup[color]:
+                    code = code << 1 | reader.read(1)
+                    bits += 1
+                length = lookup[color][(bits, code)]
+                steps += 1
+                for i in range(x, x + length):
+                    if color:
+                        out[y * STRIDE + i // 8] |= 0x80 >> (i % 8)
+                x += length
+                color = 1 - color
+        return bytes(out), steps
+
+
+# ---- Context-modelled binary arithmetic coding ----------------------------
+
+CM_PROB_BITS = 12
+CM_ADAPT_SHIFT = 4
+CM_TOP = 1 << 24
+
+
+def cm_context(data, x, y):
+    """Eight neighbours: two to the left, five above, one two rows up."""
+    return (
+        pixel(data, x - 1, y)
+        | pixel(data, x - 2, y) << 1
+        | pixel(data, x - 2, y - 1) << 2
+        | pixel(data, x - 1, y - 1) << 3
+        | pixel(data, x, y - 1) << 4
+        | pixel(data, x + 1, y - 1) << 5
+        | pixel(data, x + 2, y - 1) << 6
+        | pixel(data, x, y - 2) << 7
+    )
+
+
+class RangeEncoder:
+    """LZMA-style carry-less range coder with adaptive binary probabilities."""
+
+    def __init__(self):
+        self.low = 0
+        self.range = 0xFFFFFFFF
+        self.cache = 0
+        self.cache_size = 1
+        self.out = bytearray()
+
+    def shift_low(self):
+        if self.low < 0xFF000000 or self.low >= 1 << 32:
+            carry = self.low >> 32
+            temp = self.cache
+            while True:
+                self.out.append((temp + carry) & 0xFF)
+                temp = 0xFF
+                self.cache_size -= 1
+                if self.cache_size == 0:
+                    break
+            self.cache = (self.low >> 24) & 0xFF
+        self.cache_size += 1
+        self.low = (self.low << 8) & 0xFFFFFFFF
+
+    def encode(self, probs, index, bit):
+        p = probs[index]
+        bound = (self.range >> CM_PROB_BITS) * p
+        if bit:
+            self.low += bound
+            self.range -= bound
+            probs[index] = p - (p >> CM_ADAPT_SHIFT)
+        else:
+            self.range = bound
+            probs[index] = p + (((1 << CM_PROB_BITS) - p) >> CM_ADAPT_SHIFT)
+        while self.range < CM_TOP:
+            self.range <<= 8
+            self.shift_low()
+
+    def finish(self):
+        for _ in range(5):
+            self.shift_low()
+        # The first byte is always zero and trailing zeros are implied by the decoder
+        return bytes(self.out[1:]).rstrip(b"\0")
+
+
+class RangeDecoder:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+        self.range = 0xFFFFFFFF
+        self.code = 0
+        for _ in range(4):
+            self.code = self.code << 8 | self.next()
+
+    def next(self):
+        byte = self.data[self.pos] if self.pos < len(self.data) else 0
+        self.pos += 1
+        return byte
+
+    def decode(self, probs, index):
+        p = probs[index]
+        bound = (self.range >> CM_PROB_BITS) * p
+        if self.code < bound:
+            self.range = bound
+            probs[index] = p + (((1 << CM_PROB_BITS) - p) >> CM_ADAPT_SHIFT)
+            bit = 0
+        else:
+            self.code -= bound
+            self.range -= bound
+            probs[index] = p - (p >> CM_ADAPT_SHIFT)
+            bit = 1
+        while self.range < CM_TOP:
+            self.range = (self.range << 8) & 0xFFFFFFFF
+            self.code = ((self.code << 8) | self.next()) & 0xFFFFFFFF
+        return bit
+
+
+def cm_encode(data):
+    probs = [1 << (CM_PROB_BITS - 1)] * 256
+    rc = RangeEncoder()
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            rc.encode(probs, cm_context(data, x, y), pixel(data, x, y))
+    return rc.finish()
+
+
+def cm_decode(data, size):
+    probs = [1 << (CM_PROB_BITS - 1)] * 256
+    rc = RangeDecoder(data)
+    out = bytearray(size)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if rc.decode(probs, cm_context(out, x, y)):
+                out[y * STRIDE + x // 8] |= 0x80 >> (x % 8)
+    return bytes(out), WIDTH * HEIGHT
+
+
+# ---- Benchmark ------------------------------------------------------------
+
+
+def codecs(images):
+    huffman = HuffmanRuns(images)
+    frame = STRIDE * HEIGHT
+    return [
+        # name, encode, decode, decoder RAM in bytes, shared tables in flash, notes
+        ("raw", lambda d: d, lambda d, n: (d, HEIGHT), 0, 0, "current art.c layout"),
+        ("packbits", packbits_encode, packbits_decode, 0, 0, "streams by row"),
+        (
+            "heatshrink w8 l4",
+            lambda d: heatshrink_encode(d, 8, 4),
+            lambda d, n: heatshrink_decode(d, n, 8, 4),
+            (1 << 8) + 32 + 16,
+            0,
+            "window + input buffer",
+        ),
+        (
+            "heatshrink w10 l5",
+            lambda d: heatshrink_encode(d, 10, 5),
+            lambda d, n: heatshrink_decode(d, n, 10, 5),
+            (1 << 10) + 32 + 16,
+            0,
+            "window + input buffer",
+        ),
+        ("lz4", lz4_encode, lz4_decode, frame, 0, "needs the whole frame as history"),
+        (
+            "huffman runs",
+            huffman.encode,
+            huffman.decode,
+            huffman.table_size(),
+            huffman.table_size(),
+            "static tables shared by the set",
+        ),
+        (
+            "context model",
+            cm_encode,
+            cm_decode,
+            256 * 2 + 2 * STRIDE + 12,
+            0,
+            "256 contexts, two rows of history",
+        ),
+    ]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--art", default=ART_C, help="art source to read (default: widgets/art.c)")
+    parser.add_argument("--json", action="store_true", help="print results as JSON")
+    args = parser.parse_args()
+
+    images = load_art(args.art)
+    if not images:
+        sys.exit(f"{args.art}: no images found")
+
+    raw_total = len(images) * STRIDE * HEIGHT
+    results = []
+    for name, encode, decode, ram, tables, notes in codecs(images):
+        total = tables
+        worst = 0
+        steps = 0
+        for image, data in images:
+            packed = encode(data)
+            decoded, n = decode(packed, len(data))
+            if decoded != data:
+                sys.exit(f"{name}: {image} does not round-trip")
+            total += len(packed)
+            worst = max(worst, len(packed))
+            steps = max(steps, n)
+        results.append(
+            {
+                "codec": name,
+                "bytes": total,
+                "ratio": raw_total / total,
+                "worst_slide": worst,
+                "decoder_ram": ram,
+                "decode_steps": steps,
+                "notes": notes,
+            }
+        )
+
+    if args.json:
+        json.dump(results, sys.stdout, indent=2)
+        print()
+        return
+
+    print(f"{len(images)} images, {WIDTH}x{HEIGHT} 1bpp, {raw_total} bytes raw\n")
+    print(f"{'codec':<18} {'bytes':>7} {'ratio':>6} {'worst':>6} {'ram':>6} {'steps':>6}  notes")
+    for r in results:
+        print(
+            f"{r['codec']:<18} {r['bytes']:>7} {r['ratio']:>6.2f} {r['worst_slide']:>6} "
+            f"{r['decoder_ram']:>6} {r['decode_steps']:>6}  {r['notes']}"
+        )
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Pre-pack the slideshow art as LS0xx panel rows.
+
+Reads the 1bpp images from art.c and writes a C file defining
+`art_ls0xx_rows[][SLIDE_HEIGHT][stride]` and `art_ls0xx_count` (see
+widgets/slides.c). Each row is laid out exactly as the LS0xx driver expects
+it in a flush buffer: pixel x in bit x % 8 of byte x / 8 (LSB first), 1 for
+white, whatever the image palette says. Bits past the image width are zero.
+The flush stage can then copy rows straight from flash without converting
+any pixels.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(__file__))
+
+from art_codecs import HEIGHT, STRIDE, WIDTH, load_art, pixel  # noqa: E402
+
+PALETTE_SIZE = 8
+
+
+def load_palettes(path):
+    """Map image name to True when palette index 1 is the lighter colour."""
+    with open(path, "rb") as f:
+        text = f.read().decode("ascii")
+
+    palettes = {}
+    for match in re.finditer(r"uint8_t (\w+)_map\[\] = \{(.*?)\};", text, re.S):
+        values = [int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", match.group(2))]
+        black, white = values[0:3], values[4:7]
+        palettes[match.group(1)] = sum(white) > sum(black)
+    return palettes
+
+
+def pack(data, index1_white):
+    out = bytearray(STRIDE * HEIGHT)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if pixel(data, x, y) == index1_white:
+                out[y * STRIDE + x // 8] |= 1 << (x % 8)
+    return bytes(out)
+
+
+def c_rows(name, data):
+    lines = [f"    /* {name} */", "    {"]
+    for y in range(HEIGHT):
+        row = data[y * STRIDE : (y + 1) * STRIDE]
+        lines.append("        {" + ", ".join(f"0x{b:02x}" for b in row) + "},")
+    lines.append("    },")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("-o", "--output", required=True, help="C file to write")
+    parser.add_argument("art", help="art.c to read the images from")
+    args = parser.parse_args()
+
+    images = load_art(args.art)
+    if not images:
+        sys.exit(f"{args.art}: no images found")
+    palettes = load_palettes(args.art)
+
+    slides = [c_rows(name, pack(data, palettes[name])) for name, data in images]
+
+    with open(args.output, "w") as f:
+        f.write("/* Generated by art_ls0xx.py, do not edit */\n\n")
+        f.write("#include <zephyr/kernel.h>\n")
+        f.write('#include "slides.h"\n\n')
+        f.write("const uint8_t art_ls0xx_rows[][SLIDE_HEIGHT][DIV_ROUND_UP(SLIDE_WIDTH, 8)] = {\n")
+        f.write("\n".join(slides))
+        f.write("\n};\n\nconst size_t art_ls0xx_count = ARRAY_SIZE(art_ls0xx_rows);\n")
+
+    print(f"art_ls0xx.py: {len(images)} slides, {len(images) * STRIDE * HEIGHT} bytes of rows")
+
+
+if __name__ == "__main__":
+    main()
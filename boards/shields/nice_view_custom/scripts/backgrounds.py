@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Rasterise the static parts of the status canvases.
+
+Writes a C file with one 1bpp background per canvas (see draw_background() in
+widgets/util.h): the battery outline, the WPM box and the profile rings. They
+are drawn unrotated, in the same coordinates the draw_* functions use, so a
+redraw can start from a copy of the background and only draw what changes.
+Rows are MSB first, 1 for foreground.
+"""
+
+import argparse
+
+CANVAS_SIZE = 68
+STRIDE = (CANVAS_SIZE + 7) // 8
+
+# Ring centres and radius from draw_middle(), drawn 2 px wide
+PROFILE_RINGS = [(13, 13), (55, 13), (34, 34), (13, 55), (55, 55)]
+RING_RADIUS = 13
+RING_WIDTH = 2
+
+# Sub-samples per pixel edge when deciding which pixels a ring covers
+SAMPLES = 8
+
+
+class Canvas:
+    def __init__(self):
+        self.px = [[0] * CANVAS_SIZE for _ in range(CANVAS_SIZE)]
+
+    def rect(self, x, y, w, h, value):
+        for yy in range(max(y, 0), min(y + h, CANVAS_SIZE)):
+            for xx in range(max(x, 0), min(x + w, CANVAS_SIZE)):
+                self.px[yy][xx] = value
+
+    def ring(self, cx, cy, radius, width):
+        # Like a 1-bit LVGL arc: a pixel is set when more than half of it is covered
+        outer = radius + 0.5
+        inner = outer - width
+        for y in range(cy - radius, cy + radius + 1):
+            for x in range(cx - radius, cx + radius + 1):
+                covered = 0
+                for sy in range(SAMPLES):
+                    for sx in range(SAMPLES):
+                        dx = x + (sx + 0.5) / SAMPLES - (cx + 0.5)
+                        dy = y + (sy + 0.5) / SAMPLES - (cy + 0.5)
+                        if inner * inner <= dx * dx + dy * dy <= outer * outer:
+                            covered += 1
+                if covered * 2 > SAMPLES * SAMPLES and 0 <= x < CANVAS_SIZE and 0 <= y < CANVAS_SIZE:
+                    self.px[y][x] = 1
+
+    def pack(self):
+        out = bytearray(STRIDE * CANVAS_SIZE)
+        for y, row in enumerate(self.px):
+            for x, value in enumerate(row):
+                if value:
+                    out[y * STRIDE + x // 8] |= 0x80 >> (x % 8)
+        return bytes(out)
+
+
+def battery(canvas):
+    # Outline and tip from draw_battery(); the level and bolt are drawn over them
+    canvas.rect(0, 2, 29, 12, 1)
+    canvas.rect(1, 3, 27, 10, 0)
+    canvas.rect(30, 5, 3, 6, 1)
+    canvas.rect(31, 6, 1, 4, 0)
+
+
+def central_top():
+    canvas = Canvas()
+    battery(canvas)
+    # WPM box from draw_top()
+    canvas.rect(0, 21, 68, 42, 1)
+    canvas.rect(1, 22, 66, 40, 0)
+    return canvas
+
+
+def central_middle():
+    canvas = Canvas()
+    for cx, cy in PROFILE_RINGS:
+        canvas.ring(cx, cy, RING_RADIUS, RING_WIDTH)
+    return canvas
+
+
+def peripheral_top():
+    canvas = Canvas()
+    battery(canvas)
+    return canvas
+
+
+BACKGROUNDS = [
+    ("background_top", central_top),
+    ("background_middle", central_middle),
+    ("background_battery", peripheral_top),
+]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("-o", "--output", required=True, help="C file to write")
+    args = parser.parse_args()
+
+    with open(args.output, "w") as f:
+        f.write("/* Generated by backgrounds.py, do not edit */\n\n")
+        f.write("#include <zephyr/kernel.h>\n")
+        f.write('#include "util.h"\n')
+        for name, draw in BACKGROUNDS:
+            data = draw().pack()
+            f.write(f"\nconst uint8_t {name}[CANVAS_BACKGROUND_SIZE] = {{\n")
+            for y in range(CANVAS_SIZE):
+                row = data[y * STRIDE : (y + 1) * STRIDE]
+                f.write("    " + ", ".join(f"0x{b:02x}" for b in row) + ",\n")
+            f.write("};\n")
+
+    print(f"backgrounds.py: {len(BACKGROUNDS)} backgrounds, {STRIDE * CANVAS_SIZE} bytes each")
+
+
+if __name__ == "__main__":
+    main()
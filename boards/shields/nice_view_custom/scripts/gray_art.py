@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Convert grayscale PGM images into 4bpp slides for the nice!view dither engine.
+
+Each image becomes a `struct gray_art` (see widgets/dither.h): two pixels per
+byte, left pixel in the high nibble, 0 black to 15 white, optionally PackBits
+compressed. The generated C file defines `gray_arts[]` and `gray_art_count`.
+"""
+
+import argparse
+import os
+import sys
+
+
+def read_pgm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    tokens = []
+    pos = 0
+    # Header: magic, width, height, maxval, with '#' comments allowed in between
+    while len(tokens) < 4:
+        while pos < len(data) and data[pos : pos + 1].isspace():
+            pos += 1
+        if data[pos : pos + 1] == b"#":
+            while pos < len(data) and data[pos : pos + 1] not in (b"\n", b"\r"):
+                pos += 1
+            continue
+        start = pos
+        while pos < len(data) and not data[pos : pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos])
+
+    magic = tokens[0]
+    width, height, maxval = (int(t) for t in tokens[1:])
+    if magic == b"P5":
+        pos += 1
+        size = 2 if maxval > 255 else 1
+        raw = data[pos : pos + width * height * size]
+        if len(raw) != width * height * size:
+            raise ValueError(f"{path}: truncated image data")
+        if size == 1:
+            pixels = list(raw)
+        else:
+            pixels = [raw[i] << 8 | raw[i + 1] for i in range(0, len(raw), 2)]
+    elif magic == b"P2":
+        pixels = [int(t) for t in data[pos:].split()[: width * height]]
+        if len(pixels) != width * height:
+            raise ValueError(f"{path}: truncated image data")
+    else:
+        raise ValueError(f"{path}: not a PGM image")
+
+    return width, height, [(p * 15 + maxval // 2) // maxval for p in pixels]
+
+
+def pack_nibbles(width, height, levels):
+    out = bytearray()
+    for y in range(height):
+        row = levels[y * width : (y + 1) * width]
+        if width % 2:
+            row.append(0)
+        for x in range(0, len(row), 2):
+            out.append(row[x] << 4 | row[x + 1])
+    return bytes(out)
+
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run > 1:
+            out += bytes([257 - run, data[i]])
+            i += run
+            continue
+
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def c_array(name, data):
+    lines = [f"static const uint8_t {name}[] = {{"]
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join(f"0x{b:02x}," for b in data[i : i + 16]))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("-o", "--output", required=True, help="C file to write")
+    parser.add_argument("--width", type=int, default=140)
+    parser.add_argument("--height", type=int, default=68)
+    parser.add_argument("--packbits", action="store_true", help="PackBits compress the slides")
+    parser.add_argument("images", nargs="*", help="PGM images, in slide order")
+    args = parser.parse_args()
+
+    if not args.images:
+        sys.exit("gray_art.py: no PGM images found for the grayscale slideshow")
+
+    arrays = []
+    entries = []
+    raw_total = 0
+    stored_total = 0
+    for index, path in enumerate(args.images):
+        width, height, levels = read_pgm(path)
+        if (width, height) != (args.width, args.height):
+            sys.exit(f"{path}: image is {width}x{height}, expected {args.width}x{args.height}")
+
+        data = pack_nibbles(width, height, levels)
+        raw_total += len(data)
+        flags = "0"
+        if args.packbits:
+            data = packbits(data)
+            flags = "GRAY_ART_PACKBITS"
+        stored_total += len(data)
+
+        name = f"gray_art_{index}"
+        arrays.append(f"/* {os.path.basename(path)} */\n" + c_array(name, data))
+        entries.append(
+            f"    {{.width = {width}, .height = {height}, .flags = {flags}, "
+            f".data_size = sizeof({name}), .data = {name}}},"
+        )
+
+    with open(args.output, "w") as f:
+        f.write("/* Generated by gray_art.py, do not edit */\n\n")
+        f.write('#include "dither.h"\n\n')
+        f.write("\n\n".join(arrays))
+        f.write("\n\nconst struct gray_art gray_arts[] = {\n")
+        f.write("\n".join(entries))
+        f.write("\n};\n\nconst size_t gray_art_count = ARRAY_SIZE(gray_arts);\n")
+
+    print(
+        f"gray_art.py: {len(args.images)} slides, {raw_total} bytes at 4bpp, "
+        f"{stored_total} bytes stored"
+    )
+
+
+if __name__ == "__main__":
+    main()
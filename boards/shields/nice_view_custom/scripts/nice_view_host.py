@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Host side of the nice!view host link (see widgets/host_link.h).
+
+Sends line commands to the keyboard's USB CDC ACM port:
+
+    nice_view_host.py /dev/ttyACM0 clock            set the clock to the host time
+    nice_view_host.py /dev/ttyACM0 clock --resync 60  and keep it in step every hour
+    nice_view_host.py - clock --at 12:34            print a fixed time instead
+    playerctl metadata -F -f '{{title}}' | nice_view_host.py /dev/ttyACM0 text
+                                                   show each line read from stdin
+    nice_view_host.py /dev/ttyACM1 mirror --frames out/
+                                                   rebuild the screen from the display
+                                                   mirror (widgets/mirror.h)
+
+A port of `-` writes the commands to stdout, so the protocol can be tried
+without a keyboard. Needs pyserial for a real port.
+"""
+
+import argparse
+import calendar
+import os
+import struct
+import sys
+import time
+
+MIRROR_MAGIC = 0xA5
+MIRROR_HEADER = struct.Struct("<BBBBBBI")
+MIRROR_LAST = 0x01
+
+
+class Link:
+    def __init__(self, port):
+        if port == "-":
+            self.out = None
+        else:
+            import serial
+
+            self.out = serial.Serial(port, 115200, timeout=1)
+
+    def send(self, line):
+        data = (line + "\n").encode("ascii", errors="replace")
+        if self.out is None:
+            sys.stdout.write(data.decode("ascii"))
+            sys.stdout.flush()
+        else:
+            self.out.write(data)
+
+
+def local_offset_minutes(now):
+    return round((calendar.timegm(time.localtime(now)) - int(now)) / 60)
+
+
+def clock_command(at):
+    now = time.time()
+    offset = local_offset_minutes(now)
+    if at is not None:
+        hours, minutes = (int(v) for v in at.split(":"))
+        # Fake instant on the current UTC day that reads `at` locally
+        now = int(now) // 86400 * 86400 + (hours * 60 + minutes - offset) * 60
+    return "T %d %d" % (int(now), offset)
+
+
+def run_clock(link, args):
+    while True:
+        link.send(clock_command(args.at))
+        if args.resync <= 0:
+            return
+        time.sleep(args.resync * 60)
+
+
+def text_command(old, new):
+    """Shortest command turning `old` into `new` on the keyboard."""
+    keep = 0
+    while keep < min(len(old), len(new)) and old[keep] == new[keep]:
+        keep += 1
+
+    full = "S " + new
+    delta = "D %d %s" % (keep, new[keep:])
+    return delta if keep > 0 and len(delta) < len(full) else full
+
+
+def run_text(link, args):
+    shown = None
+    sent_at = 0
+    for line in sys.stdin:
+        text = line.strip()[: args.max_len]
+        # Unchanged text is not sent at all, unless the keyboard needs a refresh to keep it up
+        if text == shown and time.monotonic() - sent_at < args.refresh:
+            continue
+        # The first line is always sent whole, whatever the keyboard shows
+        link.send(text_command(shown or "", text))
+        shown = text
+        sent_at = time.monotonic()
+
+
+def open_input(port):
+    if port == "-":
+        return sys.stdin.buffer
+    if os.path.isfile(port):
+        return open(port, "rb")
+
+    import serial
+
+    # Opening the port tells the keyboard to send a whole frame first
+    return serial.Serial(port, 115200, timeout=None)
+
+
+def read_exact(stream, size):
+    data = b""
+    while len(data) < size:
+        chunk = stream.read(size - len(data))
+        if not chunk:
+            raise EOFError
+        data += chunk
+    return data
+
+
+def write_pbm(path, screen, stride):
+    with open(path, "wb") as f:
+        f.write(b"P4\n%d %d\n" % (stride * 8, len(screen)))
+        for row in screen:
+            # Rows not seen yet are drawn white
+            row = row if row is not None else b"\xff" * stride
+            # Panel rows are LSB first with 1 for white, PBM is MSB first with 1 for black
+            f.write(bytes(~int("{:08b}".format(b)[::-1], 2) & 0xFF for b in row))
+
+
+def run_mirror(link, args):
+    stream = open_input(args.port)
+    record = open(args.record, "wb") if args.record else None
+    screen = [None] * args.height
+    stride = 20
+    rows = redundant = refreshes = 0
+
+    if args.frames:
+        os.makedirs(args.frames, exist_ok=True)
+
+    try:
+        while True:
+            # Resynchronise on the magic byte after a partial record
+            if read_exact(stream, 1)[0] != MIRROR_MAGIC:
+                continue
+            header = bytes([MIRROR_MAGIC]) + read_exact(stream, MIRROR_HEADER.size - 1)
+            _, kind, first, count, row_bytes, flags, ms = MIRROR_HEADER.unpack(header)
+            payload = read_exact(stream, count * row_bytes if kind == ord("R") else
+                                 4 if kind == ord("D") else 0)
+            if record:
+                record.write(header + payload)
+
+            if kind == ord("D"):
+                print("%10d ms  %d records dropped" % (ms, struct.unpack("<I", payload)[0]))
+                continue
+            if kind == ord("C"):
+                screen = [b"\xff" * stride] * args.height
+                print("%10d ms  clear command" % ms)
+                flags = MIRROR_LAST
+            else:
+                stride = row_bytes
+                for i in range(count):
+                    row = payload[i * row_bytes:(i + 1) * row_bytes]
+                    if first + i < args.height:
+                        redundant += screen[first + i] == row
+                        screen[first + i] = row
+                rows += count
+
+            if flags & MIRROR_LAST:
+                refreshes += 1
+                print("%10d ms  refresh %d: %d rows sent, %d unchanged" %
+                      (ms, refreshes, rows, redundant))
+                if args.frames:
+                    write_pbm(os.path.join(args.frames, "frame_%05d.pbm" % refreshes), screen,
+                              stride)
+                rows = redundant = 0
+    except (EOFError, KeyboardInterrupt):
+        pass
+    finally:
+        if record:
+            record.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port", help="serial port of the keyboard, - for stdout")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    clock = commands.add_parser("clock", help="set the clock")
+    clock.add_argument("--at", metavar="HH:MM", help="send this local time instead of now")
+    clock.add_argument("--resync", type=int, default=0, metavar="MIN",
+                       help="send the time again every MIN minutes")
+    clock.set_defaults(run=run_clock)
+
+    text = commands.add_parser("text", help="show each line read from stdin")
+    text.add_argument("--max-len", type=int, default=31, metavar="N",
+                      help="CONFIG_NICE_VIEW_WIDGET_HOST_TEXT_MAX_LEN of the keyboard")
+    text.add_argument("--refresh", type=int, default=300, metavar="S",
+                      help="send an unchanged line again after S seconds, below the "
+                      "keyboard's CONFIG_NICE_VIEW_WIDGET_HOST_TEXT_TIMEOUT_S")
+    text.set_defaults(run=run_text)
+
+    mirror = commands.add_parser("mirror", help="rebuild the screen from the display mirror; "
+                                 "the port may also be a file saved with --record")
+    mirror.add_argument("--frames", metavar="DIR", help="write each refresh as a PBM image")
+    mirror.add_argument("--record", metavar="FILE", help="save the raw stream for replaying")
+    mirror.add_argument("--height", type=int, default=68, help="panel rows")
+    mirror.set_defaults(run=run_mirror, passive=True)
+
+    args = parser.parse_args()
+    args.run(None if getattr(args, "passive", False) else Link(args.port), args)
+
+
+if __name__ == "__main__":
+    main()
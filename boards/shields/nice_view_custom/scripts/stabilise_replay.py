@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Replay battery, WPM and connection updates through the display stabiliser.
+
+Reads a trace of `stabilise <field> <value> <ms>` lines, which is what the
+keyboard logs at debug level with CONFIG_NICE_VIEW_WIDGET_STABILISE=y (other
+log lines are skipped), runs it through the same rules as widgets/stabilise.c
+and prints how many renders each field would cause with and without it:
+
+    stabilise_replay.py keyboard.log
+    stabilise_replay.py --field battery=4,2,30000 --field wpm=5,2,1000 keyboard.log
+"""
+
+import argparse
+import re
+import sys
+
+TRACE_LINE = re.compile(r"stabilise (\w+) (-?\d+) (\d+)")
+
+# quantum, hysteresis, hold_ms; the Kconfig defaults
+DEFAULTS = {
+    "battery": (4, 2, 30000),
+    "wpm": (1, 1, 0),
+    "connection": (1, 0, 3000),
+}
+
+
+class Stabiliser:
+    def __init__(self, quantum, hysteresis, hold_ms):
+        self.quantum = max(quantum, 1)
+        self.hysteresis = hysteresis
+        self.hold_ms = hold_ms
+        self.valid = False
+        self.pending = False
+        self.rising = False
+        self.raw = 0
+        self.shown = 0
+        self.changed_at = 0
+        self.updates = 0
+        self.changes = 0
+
+    def quantise(self, value):
+        return max(value, 0) // self.quantum * self.quantum
+
+    def settle(self, now):
+        target = self.quantise(self.raw)
+        rising = target > self.shown
+
+        self.pending = False
+        if target == self.shown:
+            return False
+
+        if rising != self.rising:
+            offset = -self.hysteresis if rising else self.hysteresis
+            cleared = self.quantise(self.raw + offset)
+            if cleared <= self.shown if rising else cleared >= self.shown:
+                return False
+
+        if now < self.changed_at + self.hold_ms:
+            self.pending = True
+            return False
+
+        self.shown = target
+        self.rising = rising
+        self.changed_at = now
+        self.changes += 1
+        return True
+
+    def deadline(self):
+        return self.changed_at + self.hold_ms if self.pending else None
+
+    def update(self, raw, now):
+        self.raw = raw
+        self.updates += 1
+        if not self.valid:
+            self.valid = True
+            self.pending = False
+            self.shown = self.quantise(raw)
+            self.changed_at = now
+            self.changes += 1
+        else:
+            self.settle(now)
+
+
+def run_due(stabilisers, now):
+    for s in stabilisers.values():
+        deadline = s.deadline()
+        if deadline is not None and (now is None or deadline <= now):
+            s.settle(deadline)
+
+
+def parse_field(text):
+    name, _, values = text.partition("=")
+    quantum, hysteresis, hold_ms = (int(v) for v in values.split(","))
+    return name, (quantum, hysteresis, hold_ms)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument(
+        "--field",
+        action="append",
+        type=parse_field,
+        default=[],
+        metavar="NAME=QUANTUM,HYSTERESIS,HOLD_MS",
+        help="override a field's settings",
+    )
+    parser.add_argument("trace", nargs="?", help="log or trace file (default: stdin)")
+    args = parser.parse_args()
+
+    config = dict(DEFAULTS)
+    config.update(args.field)
+
+    stabilisers = {}
+    trace = open(args.trace) if args.trace else sys.stdin
+    with trace:
+        for line in trace:
+            match = TRACE_LINE.search(line)
+            if match is None:
+                continue
+            name, raw, now = match.group(1), int(match.group(2)), int(match.group(3))
+            if name not in stabilisers:
+                stabilisers[name] = Stabiliser(*config.get(name, (1, 0, 0)))
+            # Late values the keyboard would have shown before this update
+            run_due(stabilisers, now)
+            stabilisers[name].update(raw, now)
+
+    # Hold-backs still open at the end of the trace are shown eventually
+    run_due(stabilisers, None)
+
+    if not stabilisers:
+        sys.exit("No stabilise lines in the trace; enable debug logging on the keyboard")
+
+    print(f"{'field':12} {'updates':>8} {'renders':>8} {'saved':>8}")
+    total_updates = total_changes = 0
+    for name, s in sorted(stabilisers.items()):
+        print(f"{name:12} {s.updates:8} {s.changes:8} {s.updates - s.changes:8}")
+        total_updates += s.updates
+        total_changes += s.changes
+    print(f"{'total':12} {total_updates:8} {total_changes:8} {total_updates - total_changes:8}")
+
+
+if __name__ == "__main__":
+    main()
@@ -17,13 +17,8 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM1 uint8_t hammerbeam1_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe3, 0xfe, 0x0f, 0x38, 0x72, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7e, 0x9c, 0xff, 0xfe, 0x70, 
@@ -111,13 +106,8 @@ const lv_img_dsc_t hammerbeam1 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM2 uint8_t hammerbeam2_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0x5a, 0xba, 0xbe, 0x08, 0x08, 0x63, 0xa2, 0x49, 0xbf, 0x87, 0xdb, 0xfe, 0x82, 0x8f, 0xdb, 0xfe, 0x70, 
@@ -204,13 +194,8 @@ const lv_img_dsc_t hammerbeam2 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM3 uint8_t hammerbeam3_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe0, 0x2b, 0xaa, 0xb6, 0xb2, 0x0a, 0x00, 0x31, 0xbc, 0x00, 0x00, 0x80, 0x00, 0x01, 0x55, 0x40, 0x00, 0x70, 
@@ -298,13 +283,8 @@ const lv_img_dsc_t hammerbeam3 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM4 uint8_t hammerbeam4_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe7, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xf9, 0xce, 0xe3, 0xff, 0xff, 0xf3, 0xff, 0xb9, 0xff, 0xfe, 0x70, 
@@ -392,13 +372,8 @@ const lv_img_dsc_t hammerbeam4 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM5 uint8_t hammerbeam5_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe7, 0x7f, 0xd5, 0x00, 0x33, 0xbf, 0xf9, 0x05, 0x55, 0x40, 0x07, 0x9f, 0xd1, 0x00, 0x00, 0x01, 0xfe, 0x70, 
@@ -486,13 +461,8 @@ const lv_img_dsc_t hammerbeam5 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM6 uint8_t hammerbeam6_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe6, 0x00, 0xff, 0xa8, 0x3f, 0xf0, 0xff, 0xf8, 0x00, 0x7e, 0xaa, 0xbf, 0xbb, 0xff, 0xea, 0x80, 0x00, 0x70, 
@@ -580,13 +550,8 @@ const lv_img_dsc_t hammerbeam6 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM7 uint8_t hammerbeam7_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xd7, 0xfa, 0xe1, 0xdf, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 
@@ -674,13 +639,8 @@ const lv_img_dsc_t hammerbeam7 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM8 uint8_t hammerbeam8_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe2, 0x00, 0x08, 0xab, 0xfa, 0xc1, 0x80, 0xaa, 0xaa, 0xa8, 0x20, 0x82, 0xaa, 0xaa, 0xff, 0xff, 0xfe, 0x70, 
@@ -768,13 +728,8 @@ const lv_img_dsc_t hammerbeam8 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM9 uint8_t hammerbeam9_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe7, 0xd7, 0x55, 0xc0, 0x00, 0x00, 0x00, 0x51, 0x55, 0x55, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x70, 
@@ -862,13 +817,8 @@ const lv_img_dsc_t hammerbeam9 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM10 uint8_t hammerbeam10_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0xd7, 0x7d, 0x7f, 0xf5, 0xd5, 0x55, 0x45, 0xdf, 0x35, 0x50, 0xff, 0xff, 0xfe, 0xf5, 0x31, 0xfe, 0x70, 
@@ -956,13 +906,8 @@ const lv_img_dsc_t hammerbeam10 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM11 uint8_t hammerbeam11_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe7, 0xc5, 0xfd, 0x55, 0x40, 0x15, 0x39, 0x1c, 0x37, 0xf7, 0xcf, 0x00, 0x01, 0x11, 0xd7, 0xd5, 0xfe, 0x70, 
@@ -1050,13 +995,8 @@ const lv_img_dsc_t hammerbeam11 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM12 uint8_t hammerbeam12_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0x5f, 0xd5, 0xf5, 0x5e, 0xf9, 0x5d, 0x43, 0x5d, 0x40, 0x01, 0xc5, 0x01, 0x7f, 0xe0, 0x45, 0xfe, 0x70, 
@@ -1144,13 +1084,8 @@ const lv_img_dsc_t hammerbeam12 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM13 uint8_t hammerbeam13_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe2, 0xbf, 0xaa, 0xb6, 0xaa, 0xa8, 0x6c, 0xaf, 0xee, 0x3e, 0xfb, 0xf7, 0x9f, 0xbe, 0xa8, 0x03, 0xfe, 0x70, 
@@ -1238,13 +1173,8 @@ const lv_img_dsc_t hammerbeam13 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM14 uint8_t hammerbeam14_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe0, 0x00, 0x00, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfe, 0x70, 
@@ -1332,13 +1262,8 @@ const lv_img_dsc_t hammerbeam14 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM15 uint8_t hammerbeam15_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe0, 0x02, 0xb7, 0xff, 0xfe, 0xae, 0xab, 0xab, 0x8e, 0x00, 0x02, 0x80, 0x0e, 0x00, 0xfa, 0x82, 0x00, 0x70, 
@@ -1426,13 +1351,8 @@ const lv_img_dsc_t hammerbeam15 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM16 uint8_t hammerbeam16_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe7, 0xef, 0xff, 0xff, 0x80, 0x00, 0x04, 0xff, 0xef, 0xab, 0xf0, 0xcf, 0xff, 0xc0, 0x00, 0xa0, 0x00, 0x70, 
@@ -1520,13 +1440,8 @@ const lv_img_dsc_t hammerbeam16 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM17 uint8_t hammerbeam17_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe4, 0x29, 0x3d, 0xce, 0xff, 0xff, 0xfe, 0x80, 0x2a, 0x82, 0x00, 0x81, 0xa0, 0x2e, 0xaa, 0xaf, 0xfe, 0x70, 
@@ -1614,13 +1529,8 @@ const lv_img_dsc_t hammerbeam17 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM18 uint8_t hammerbeam18_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0xfb, 0xbf, 0xf9, 0xc0, 0x30, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
@@ -1708,13 +1618,8 @@ const lv_img_dsc_t hammerbeam18 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM19 uint8_t hammerbeam19_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0x55, 0x55, 0x00, 0x00, 0x05, 0x7d, 0x55, 0x55, 0xf0, 0x03, 0xf7, 0xff, 0xd5, 0x7f, 0xff, 0xfe, 0x70, 
@@ -1802,13 +1707,8 @@ const lv_img_dsc_t hammerbeam19 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM20 uint8_t hammerbeam20_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0xdf, 0xf5, 0x55, 0x55, 0x55, 0x55, 0xff, 0x57, 0xff, 0xf5, 0x00, 0x01, 0x10, 0x00, 0x04, 0x00, 0x70, 
@@ -1896,13 +1796,8 @@ const lv_img_dsc_t hammerbeam20 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM21 uint8_t hammerbeam21_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe0, 0x00, 0x00, 0x80, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xfe, 0x70, 
@@ -1990,13 +1885,8 @@ const lv_img_dsc_t hammerbeam21 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM22 uint8_t hammerbeam22_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe0, 0x00, 0x00, 0x01, 0xfa, 0xfe, 0xaa, 0xaa, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 
@@ -2084,13 +1974,8 @@ const lv_img_dsc_t hammerbeam22 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM23 uint8_t hammerbeam23_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe0, 0x14, 0x51, 0x1d, 0x37, 0x7d, 0xdf, 0xd7, 0x7d, 0x74, 0xd5, 0xd5, 0x7f, 0xff, 0xef, 0xff, 0xfe, 0x70, 
@@ -2178,13 +2063,8 @@ const lv_img_dsc_t hammerbeam23 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM24 uint8_t hammerbeam24_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe7, 0xb7, 0xe0, 0x0f, 0x00, 0x00, 0x04, 0x8f, 0xcb, 0x70, 0x0f, 0xa8, 0x37, 0xfe, 0xdc, 0x0f, 0xfe, 0x70, 
@@ -2272,13 +2152,8 @@ const lv_img_dsc_t hammerbeam24 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM25 uint8_t hammerbeam25_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0x54, 0x15, 0x41, 0x3f, 0xf5, 0xf7, 0xf5, 0x55, 0x15, 0x7f, 0xff, 0xf5, 0xd5, 0xff, 0xd5, 0xfe, 0x70, 
@@ -2366,13 +2241,8 @@ const lv_img_dsc_t hammerbeam25 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM26 uint8_t hammerbeam26_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe0, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x70, 
@@ -2460,13 +2330,8 @@ const lv_img_dsc_t hammerbeam26 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM27 uint8_t hammerbeam27_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe0, 0xff, 0xed, 0xc0, 0x91, 0xe1, 0x55, 0x55, 0x55, 0x50, 0x00, 0x7d, 0xff, 0x7f, 0xef, 0x7f, 0xfe, 0x70, 
@@ -2554,13 +2419,8 @@ const lv_img_dsc_t hammerbeam27 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM28 uint8_t hammerbeam28_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x06, 0xe0, 0x0e, 0xff, 0xdf, 0x55, 0x7f, 0xf0, 0x57, 0xfe, 0x70, 
@@ -2648,13 +2508,8 @@ const lv_img_dsc_t hammerbeam28 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM29 uint8_t hammerbeam29_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0xef, 0xff, 0xff, 0xf5, 0x55, 0x55, 0xff, 0xdf, 0xff, 0xff, 0x07, 0xff, 0xbe, 0x00, 0x01, 0xfe, 0x70, 
@@ -2742,13 +2597,8 @@ const lv_img_dsc_t hammerbeam29 = {
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM30 uint8_t hammerbeam30_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
         0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
 
   0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
   0xe5, 0x7e, 0x07, 0xc1, 0xe0, 0x16, 0x04, 0x15, 0x5f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x05, 0x56, 0x00, 0x70, 
@@ -0,0 +1,118 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include "art_cm.h"
+#include "scratch.h"
+
+SCRATCH_RESERVE("art_cm", sizeof(struct art_cm_decoder));
+
+/*
+ * LZMA style range decoder with 12 bit probabilities. Must match the encoder
+ * in scripts/art_codecs.py bit for bit.
+ */
+#define PROB_BITS 12
+#define ADAPT_SHIFT 4
+#define RANGE_TOP BIT(24)
+
+#define ART_CM_MAX_WIDTH 160
+
+static const uint8_t zero_row[DIV_ROUND_UP(ART_CM_MAX_WIDTH, 8)];
+
+static inline uint8_t next_byte(struct art_cm_decoder *dec) {
+    /* The encoder drops trailing zero bytes */
+    return dec->src < dec->end ? *dec->src++ : 0;
+}
+
+static inline int decode_bit(struct art_cm_decoder *dec, uint16_t *prob) {
+    uint32_t bound = (dec->range >> PROB_BITS) * *prob;
+    int bit;
+
+    if (dec->code < bound) {
+        dec->range = bound;
+        *prob += (BIT(PROB_BITS) - *prob) >> ADAPT_SHIFT;
+        bit = 0;
+    } else {
+        dec->code -= bound;
+        dec->range -= bound;
+        *prob -= *prob >> ADAPT_SHIFT;
+        bit = 1;
+    }
+
+    while (dec->range < RANGE_TOP) {
+        dec->range <<= 8;
+        dec->code = (dec->code << 8) | next_byte(dec);
+    }
+
+    return bit;
+}
+
+static inline int pixel(const uint8_t *row, int x, int width) {
+    if (x < 0 || x >= width) {
+        return 0;
+    }
+    return (row[x / 8] >> (7 - x % 8)) & 1;
+}
+
+void art_cm_decoder_init(struct art_cm_decoder *dec, const struct art_cm_slide *slide) {
+    dec->src = slide->data;
+    dec->end = slide->data + slide->data_size;
+    dec->range = UINT32_MAX;
+    dec->code = 0;
+    dec->width = slide->width;
+
+    for (int i = 0; i < 4; i++) {
+        dec->code = (dec->code << 8) | next_byte(dec);
+    }
+    for (int i = 0; i < ART_CM_CONTEXTS; i++) {
+        dec->probs[i] = BIT(PROB_BITS - 1);
+    }
+}
+
+void art_cm_decode_row(struct art_cm_decoder *dec, uint8_t *row, const uint8_t *up,
+                       const uint8_t *up2) {
+    int width = dec->width;
+
+    up = up != NULL ? up : zero_row;
+    up2 = up2 != NULL ? up2 : zero_row;
+    memset(row, 0, DIV_ROUND_UP(width, 8));
+
+    /* Two pixels to the left, five above, one two rows up */
+    for (int x = 0; x < width; x++) {
+        uint8_t ctx = pixel(row, x - 1, width) | pixel(row, x - 2, width) << 1 |
+                      pixel(up, x - 2, width) << 2 | pixel(up, x - 1, width) << 3 |
+                      pixel(up, x, width) << 4 | pixel(up, x + 1, width) << 5 |
+                      pixel(up, x + 2, width) << 6 | pixel(up2, x, width) << 7;
+
+        if (decode_bit(dec, &dec->probs[ctx])) {
+            row[x / 8] |= 0x80 >> (x % 8);
+        }
+    }
+}
+
+int art_cm_decode(const struct art_cm_slide *slide, uint8_t *dst, size_t stride) {
+    if (slide->width > ART_CM_MAX_WIDTH || stride < DIV_ROUND_UP(slide->width, 8)) {
+        return -EINVAL;
+    }
+
+    /* Slides are only decoded on the display work queue; keep the model off its stack */
+    size_t mark = scratch_mark();
+    struct art_cm_decoder *dec = scratch_alloc("art_cm", sizeof(*dec));
+    if (dec == NULL) {
+        return -ENOMEM;
+    }
+
+    art_cm_decoder_init(dec, slide);
+    for (int y = 0; y < slide->height; y++) {
+        art_cm_decode_row(dec, &dst[y * stride], y > 0 ? &dst[(y - 1) * stride] : NULL,
+                          y > 1 ? &dst[(y - 2) * stride] : NULL);
+    }
+    scratch_release(mark);
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/* Contexts are formed from 8 neighbouring pixels, see art_cm.c */
+#define ART_CM_CONTEXTS 256
+
+/* 1bpp image coded pixel by pixel with an adaptive binary range coder */
+struct art_cm_slide {
+    uint16_t width;
+    uint16_t height;
+    uint32_t data_size;
+    const uint8_t *data;
+};
+
+struct art_cm_decoder {
+    const uint8_t *src;
+    const uint8_t *end;
+    uint32_t range;
+    uint32_t code;
+    uint16_t width;
+    uint16_t probs[ART_CM_CONTEXTS];
+};
+
+/*
+ * Streaming interface: rows come out top to bottom, MSB first, and each row
+ * needs the two rows decoded before it (NULL for rows above the image).
+ */
+void art_cm_decoder_init(struct art_cm_decoder *dec, const struct art_cm_slide *slide);
+void art_cm_decode_row(struct art_cm_decoder *dec, uint8_t *row, const uint8_t *up,
+                       const uint8_t *up2);
+
+/* Decode a whole slide into `dst`, rows `stride` bytes apart */
+int art_cm_decode(const struct art_cm_slide *slide, uint8_t *dst, size_t stride);
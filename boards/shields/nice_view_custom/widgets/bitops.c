@@ -0,0 +1,45 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "bitops.h"
+
+void bitops_rotate_cw8(uint8_t *dst, const uint8_t *src, size_t size) {
+    uint32_t block[4];
+
+    __ASSERT(size % 4 == 0, "size must be a multiple of 4");
+
+    /* Destination rows r..r+3, columns c..c+3 come from source rows size-1-c downwards */
+    for (size_t c = 0; c < size; c += 4) {
+        for (size_t r = 0; r < size; r += 4) {
+            for (int k = 0; k < 4; k++) {
+                block[k] = sys_get_le32(&src[(size - 1 - c - k) * size + r]);
+            }
+
+            bitops_transpose4x4(block);
+
+            for (int j = 0; j < 4; j++) {
+                sys_put_le32(block[j], &dst[(r + j) * size + c]);
+            }
+        }
+    }
+}
+
+void bitops_reverse_row(uint8_t *row, size_t len) {
+    __ASSERT(len % 4 == 0, "len must be a multiple of 4");
+
+    /* Pixel p of a little-endian word is bit p, so swap words end for end and RBIT each */
+    for (size_t i = 0, j = len - 4; i <= j && j < len; i += 4, j -= 4) {
+        uint32_t a = sys_get_le32(&row[i]);
+        uint32_t b = sys_get_le32(&row[j]);
+
+        sys_put_le32(bitops_rbit32(b), &row[i]);
+        sys_put_le32(bitops_rbit32(a), &row[j]);
+    }
+}
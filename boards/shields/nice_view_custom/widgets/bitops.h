@@ -0,0 +1,69 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/*
+ * Bit and byte shuffling kernels for the 1bpp display pipeline. On ARMv7-M and
+ * later (nRF52) these map onto RBIT, REV and PKHBT/PKHTB; elsewhere, e.g.
+ * native_sim, the portable versions below are used. Both give identical
+ * results.
+ */
+
+/* Reverse the byte order of a word (REV) */
+static inline uint32_t bitops_rev32(uint32_t v) { return __builtin_bswap32(v); }
+
+/* Portable RBIT, always built so tests can hold the instruction against it */
+static inline uint32_t bitops_rbit32_generic(uint32_t v) {
+    v = ((v >> 1) & 0x55555555) | ((v & 0x55555555) << 1);
+    v = ((v >> 2) & 0x33333333) | ((v & 0x33333333) << 2);
+    v = ((v >> 4) & 0x0F0F0F0F) | ((v & 0x0F0F0F0F) << 4);
+    return bitops_rev32(v);
+}
+
+/* Reverse the bit order of a word (RBIT) */
+static inline uint32_t bitops_rbit32(uint32_t v) {
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+    uint32_t r;
+
+    __asm__("rbit %0, %1" : "=r"(r) : "r"(v));
+    return r;
+#else
+    return bitops_rbit32_generic(v);
+#endif
+}
+
+/* Reverse the bits within each byte, keeping the byte order */
+static inline uint32_t bitops_rbit_bytes(uint32_t v) { return bitops_rev32(bitops_rbit32(v)); }
+
+/*
+ * Transpose a 4x4 block of bytes held as four little-endian words, one per
+ * row: afterwards byte j of row[k] is what byte k of row[j] was. The second
+ * step is the PKHBT/PKHTB pattern, which GCC emits on ARMv7E-M.
+ */
+static inline void bitops_transpose4x4(uint32_t row[4]) {
+    uint32_t t0 = (row[0] & 0x00FF00FF) | ((row[1] << 8) & 0xFF00FF00);
+    uint32_t t1 = ((row[0] >> 8) & 0x00FF00FF) | (row[1] & 0xFF00FF00);
+    uint32_t t2 = (row[2] & 0x00FF00FF) | ((row[3] << 8) & 0xFF00FF00);
+    uint32_t t3 = ((row[2] >> 8) & 0x00FF00FF) | (row[3] & 0xFF00FF00);
+
+    row[0] = (t0 & 0x0000FFFF) | (t2 << 16);
+    row[1] = (t1 & 0x0000FFFF) | (t3 << 16);
+    row[2] = (t0 >> 16) | (t2 & 0xFFFF0000);
+    row[3] = (t1 >> 16) | (t3 & 0xFFFF0000);
+}
+
+/*
+ * Rotate a square image of one byte per pixel 90 degrees clockwise:
+ * dst[r][c] = src[size - 1 - c][r]. `size` must be a multiple of 4.
+ */
+void bitops_rotate_cw8(uint8_t *dst, const uint8_t *src, size_t size);
+
+/* Reverse the pixel order of a 1bpp row of `len` bytes in place, `len` a multiple of 4 */
+void bitops_reverse_row(uint8_t *row, size_t len);
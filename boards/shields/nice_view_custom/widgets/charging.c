@@ -0,0 +1,160 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
+
+#include "charging.h"
+#include "util.h"
+
+LV_IMG_DECLARE(bolt);
+
+/* Battery bar geometry from draw_battery(), unrotated canvas coordinates */
+#define BAR_X 2
+#define BAR_Y 4
+#define BAR_WIDTH 25
+#define BAR_HEIGHT 8
+#define BOLT_X 9
+#define BOLT_Y (-1)
+#define BOLT_PALETTE_SIZE 4
+
+static sys_slist_t anims = SYS_SLIST_STATIC_INIT(&anims);
+static atomic_t idle;
+
+static uint8_t battery_level(const struct status_state *state) {
+    return MIN((state->battery + 2) / 4, BAR_WIDTH);
+}
+
+static bool is_active(const struct charging_anim *anim) {
+    return anim->state->charging && !atomic_get(&idle) &&
+           battery_level(anim->state) < BAR_WIDTH;
+}
+
+/* Bolt pixel over the bar, false where the bolt is transparent */
+static bool bolt_pixel(int x, int y, lv_color_t *color) {
+    x -= BOLT_X;
+    y -= BOLT_Y;
+    if (x < 0 || x >= bolt.header.w || y < 0 || y >= bolt.header.h) {
+        return false;
+    }
+
+    const lv_color32_t *palette = (const lv_color32_t *)bolt.data;
+    const uint8_t *px = bolt.data + BOLT_PALETTE_SIZE * sizeof(lv_color32_t);
+    uint32_t bit = (y * DIV_ROUND_UP(bolt.header.w * 2, 8) * 8) + x * 2;
+    uint8_t index = (px[bit / 8] >> (6 - bit % 8)) & 0x3;
+
+    if (palette[index].ch.alpha == 0) {
+        return false;
+    }
+
+    *color = lv_color_make(palette[index].ch.red, palette[index].ch.green, palette[index].ch.blue);
+    return true;
+}
+
+/* Repaint bar columns [from, to) straight into the rotated buffer and flush only their rows */
+static void paint_columns(struct charging_anim *anim, uint8_t from, uint8_t to) {
+    lv_area_t area;
+
+    if (from >= to) {
+        return;
+    }
+
+    for (int column = from; column < to; column++) {
+        int x = BAR_X + column;
+        for (int y = BAR_Y; y < BAR_Y + BAR_HEIGHT; y++) {
+            lv_color_t color = column < anim->fill ? (LVGL_FOREGROUND) : (LVGL_BACKGROUND);
+            bolt_pixel(x, y, &color);
+            anim->cbuf[x * CANVAS_SIZE + (CANVAS_SIZE - 1 - y)] = color;
+        }
+    }
+
+    lv_obj_get_coords(anim->canvas, &area);
+    area.y1 += BAR_X + from;
+    area.y2 = area.y1 + (to - from) - 1;
+    area.x2 = area.x1 + CANVAS_SIZE - 1 - BAR_Y;
+    area.x1 = area.x2 - (BAR_HEIGHT - 1);
+    lv_obj_invalidate_area(anim->canvas, &area);
+}
+
+static void charging_step(struct nice_view_widget *widget) {
+    struct charging_anim *anim = CONTAINER_OF(widget, struct charging_anim, widget);
+    uint8_t level = battery_level(anim->state);
+    uint8_t prev = anim->fill;
+
+    if (!is_active(anim)) {
+        anim->fill = level;
+        paint_columns(anim, MIN(prev, level), MAX(prev, level));
+        return;
+    }
+
+    if (anim->fill >= BAR_WIDTH) {
+        anim->fill = level;
+        paint_columns(anim, level, prev);
+    } else {
+        anim->fill = MIN(MAX(anim->fill, level) + CONFIG_NICE_VIEW_WIDGET_CHARGING_STEP,
+                         BAR_WIDTH);
+        paint_columns(anim, prev, anim->fill);
+    }
+
+    nice_view_widget_invalidate(widget);
+}
+
+void charging_anim_update(struct charging_anim *anim) {
+    uint8_t level = battery_level(anim->state);
+
+    /* The redraw just painted the bar at the battery level; put back any animated columns */
+    if (is_active(anim) && anim->fill > level) {
+        paint_columns(anim, level, anim->fill);
+    } else {
+        anim->fill = level;
+    }
+
+    if (is_active(anim)) {
+        nice_view_widget_invalidate(&anim->widget);
+    }
+}
+
+void charging_anim_init(struct charging_anim *anim, lv_obj_t *canvas, lv_color_t *cbuf,
+                        const struct status_state *state) {
+    anim->canvas = canvas;
+    anim->cbuf = cbuf;
+    anim->state = state;
+    anim->widget.name = "charging";
+    anim->widget.min_interval_ms = CONFIG_NICE_VIEW_WIDGET_CHARGING_INTERVAL_MS;
+    anim->widget.priority = UINT8_MAX - 1;
+    anim->widget.budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US;
+    anim->widget.render = charging_step;
+    lv_obj_update_layout(canvas);
+    lv_obj_get_coords(canvas, &anim->widget.region);
+
+    sys_slist_append(&anims, &anim->node);
+    nice_view_widget_register(&anim->widget);
+}
+
+static int charging_activity_listener(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+    struct charging_anim *anim;
+
+    if (ev == NULL) {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    atomic_set(&idle, ev->state != ZMK_ACTIVITY_ACTIVE);
+
+    /* Either resume the animation or let the next step park it at the battery level */
+    SYS_SLIST_FOR_EACH_CONTAINER(&anims, anim, node) { nice_view_widget_invalidate(&anim->widget); }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(charging_activity, charging_activity_listener);
+ZMK_SUBSCRIPTION(charging_activity, zmk_activity_state_changed);
@@ -0,0 +1,36 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+#include "scheduler.h"
+
+struct status_state;
+
+/*
+ * Charging animation for the battery drawn by draw_battery(). While USB power
+ * is present and the keyboard is active, the bar fills from the battery level
+ * to full in steps. Bar columns end up as panel rows after rotation, so each
+ * step repaints and flushes only the rows it changed.
+ */
+struct charging_anim {
+    struct nice_view_widget widget;
+    sys_snode_t node;
+    lv_obj_t *canvas;
+    lv_color_t *cbuf;
+    const struct status_state *state;
+    /* Bar columns currently shown filled */
+    uint8_t fill;
+};
+
+void charging_anim_init(struct charging_anim *anim, lv_obj_t *canvas, lv_color_t *cbuf,
+                        const struct status_state *state);
+
+/* Call after the canvas holding the battery has been redrawn and rotated */
+void charging_anim_update(struct charging_anim *anim);
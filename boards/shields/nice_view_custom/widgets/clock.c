@@ -0,0 +1,213 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "clock.h"
+#include "host_link.h"
+#include "park.h"
+#include "scheduler.h"
+#include "util.h"
+
+#define CLOCK_DIGITS 4
+#define CLOCK_GLYPH_WIDTH 5
+#define CLOCK_ADVANCE 6
+#define CLOCK_DASH 10
+#define CLOCK_COLON 11
+#define CLOCK_UNKNOWN 0xff
+
+#define MS_PER_MINUTE 60000
+#define MINUTES_PER_DAY 1440
+
+/* 5x7 sprites, one byte per row with the leftmost pixel in bit 4 */
+static const uint8_t glyphs[][CLOCK_HEIGHT] = {
+    {0x0e, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e}, {0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x0e},
+    {0x0e, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1f}, {0x1f, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0e},
+    {0x02, 0x06, 0x0a, 0x12, 0x1f, 0x02, 0x02}, {0x1f, 0x10, 0x1e, 0x01, 0x01, 0x11, 0x0e},
+    {0x06, 0x08, 0x10, 0x1e, 0x11, 0x11, 0x0e}, {0x1f, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},
+    {0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e}, {0x0e, 0x11, 0x11, 0x0f, 0x01, 0x02, 0x0c},
+    [CLOCK_DASH] = {0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00},
+    [CLOCK_COLON] = {0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00},
+};
+
+/* Character cell of each digit; the colon sits in cell 2 */
+static const uint8_t digit_cells[CLOCK_DIGITS] = {0, 1, 3, 4};
+
+static lv_obj_t *clock_canvas;
+static lv_color_t *clock_cbuf;
+static uint8_t shown[CLOCK_DIGITS];
+
+/* Local time in ms at the uptime `synced_at`; only used on the display work queue */
+static bool synced;
+static int64_t synced_local_ms;
+static int64_t synced_at;
+
+static void tick_work_cb(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(tick_work, tick_work_cb);
+
+static int64_t local_ms(void) { return synced_local_ms + (k_uptime_get() - synced_at); }
+
+/* Paint one sprite into the rotated canvas: unrotated (x, y) is cbuf[x * size + size - 1 - y] */
+static void paint_glyph(int cell, uint8_t glyph) {
+    int x0 = CLOCK_X + cell * CLOCK_ADVANCE;
+
+    for (int gx = 0; gx < CLOCK_GLYPH_WIDTH; gx++) {
+        lv_color_t *dst = &clock_cbuf[(x0 + gx) * CANVAS_SIZE + (CANVAS_SIZE - 1 - CLOCK_Y)];
+        for (int gy = 0; gy < CLOCK_HEIGHT; gy++) {
+            bool set = glyphs[glyph][gy] & BIT(CLOCK_GLYPH_WIDTH - 1 - gx);
+            dst[-gy] = set ? (LVGL_FOREGROUND) : (LVGL_BACKGROUND);
+        }
+    }
+}
+
+static void invalidate_cell(int cell) {
+    lv_area_t area;
+
+    lv_obj_get_coords(clock_canvas, &area);
+    area.x2 = area.x1 + CANVAS_SIZE - 1 - CLOCK_Y;
+    area.x1 = area.x2 - (CLOCK_HEIGHT - 1);
+    area.y1 += CLOCK_X + cell * CLOCK_ADVANCE;
+    area.y2 = area.y1 + CLOCK_GLYPH_WIDTH - 1;
+    lv_obj_invalidate_area(clock_canvas, &area);
+}
+
+static void current_digits(uint8_t digits[CLOCK_DIGITS]) {
+    if (!synced) {
+        memset(digits, CLOCK_DASH, CLOCK_DIGITS);
+        return;
+    }
+
+    int64_t minutes = local_ms() / MS_PER_MINUTE % MINUTES_PER_DAY;
+    if (minutes < 0) {
+        minutes += MINUTES_PER_DAY;
+    }
+
+    digits[0] = minutes / 600;
+    digits[1] = minutes / 60 % 10;
+    digits[2] = minutes % 60 / 10;
+    digits[3] = minutes % 10;
+}
+
+/*
+ * Wake at the next minute boundary, plus some slack. Any redraw of the canvas
+ * inside that slack already shows the new minute and pushes the wake on to
+ * the following one, so typing absorbs the clock's own wakes.
+ */
+static void schedule_tick(void) {
+    if (!synced) {
+        return;
+    }
+
+    int64_t into_minute = local_ms() % MS_PER_MINUTE;
+    if (into_minute < 0) {
+        into_minute += MS_PER_MINUTE;
+    }
+
+    k_work_reschedule(&tick_work,
+                      K_MSEC(MS_PER_MINUTE - into_minute + CONFIG_NICE_VIEW_WIDGET_CLOCK_SLACK_MS));
+}
+
+void clock_draw(void) {
+    uint8_t digits[CLOCK_DIGITS];
+
+    current_digits(digits);
+    paint_glyph(2, CLOCK_COLON);
+    for (int i = 0; i < CLOCK_DIGITS; i++) {
+        paint_glyph(digit_cells[i], digits[i]);
+        shown[i] = digits[i];
+    }
+
+    schedule_tick();
+}
+
+static void clock_render(struct nice_view_widget *widget) {
+    uint8_t digits[CLOCK_DIGITS];
+    int changed = 0;
+
+    current_digits(digits);
+    for (int i = 0; i < CLOCK_DIGITS; i++) {
+        if (digits[i] != shown[i]) {
+            paint_glyph(digit_cells[i], digits[i]);
+            invalidate_cell(digit_cells[i]);
+            shown[i] = digits[i];
+            changed++;
+        }
+    }
+
+    LOG_DBG("Clock tick repainted %d digits", changed);
+    schedule_tick();
+}
+
+static struct nice_view_widget clock_widget = {
+    .name = "clock",
+    .priority = UINT8_MAX - 2,
+    .budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US,
+    .render = clock_render,
+};
+
+/* Runs on the system work queue: only flag the clock, LVGL is touched by the scheduler */
+static void tick_work_cb(struct k_work *work) { nice_view_widget_invalidate(&clock_widget); }
+
+void clock_set(int64_t unix_seconds, int16_t utc_offset_min) {
+    synced_local_ms = (unix_seconds + utc_offset_min * 60) * 1000;
+    synced_at = k_uptime_get();
+    synced = true;
+
+    nice_view_widget_invalidate(&clock_widget);
+}
+
+static void clock_host_command(const char *args) {
+    char *end;
+    long long seconds = strtoll(args, &end, 10);
+    long offset = strtol(end, &end, 10);
+
+    if (end == args || seconds <= 0 || offset < -14 * 60 || offset > 14 * 60) {
+        LOG_WRN("Bad clock command: %s", args);
+        return;
+    }
+
+    clock_set(seconds, offset);
+}
+
+static struct host_link_handler clock_handler = {
+    .command = 'T',
+    .handle = clock_host_command,
+};
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK)
+/* The parked frame keeps the last minute shown; catch up on wake */
+static void clock_park(struct nice_view_park_hook *hook) { k_work_cancel_delayable(&tick_work); }
+
+static void clock_resume(struct nice_view_park_hook *hook) {
+    nice_view_widget_invalidate(&clock_widget);
+}
+
+static struct nice_view_park_hook clock_park_hook = {
+    .park = clock_park,
+    .resume = clock_resume,
+};
+#endif
+
+void clock_init(lv_obj_t *canvas, lv_color_t *cbuf) {
+    clock_canvas = canvas;
+    clock_cbuf = cbuf;
+    memset(shown, CLOCK_UNKNOWN, sizeof(shown));
+
+    lv_obj_update_layout(canvas);
+    lv_obj_get_coords(canvas, &clock_widget.region);
+
+    nice_view_widget_register(&clock_widget);
+    host_link_register(&clock_handler);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK)
+    nice_view_park_hook_register(&clock_park_hook);
+#endif
+}
@@ -0,0 +1,26 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+/* Top left of the clock in unrotated canvas coordinates, inside the WPM box */
+#define CLOCK_X 3
+#define CLOCK_Y 24
+#define CLOCK_HEIGHT 7
+
+/*
+ * HH:MM drawn straight into a rotated canvas from built-in digit sprites. The
+ * time comes from the host (see host_link.h) and is kept with the uptime
+ * counter; once a minute only the digits that changed are repainted.
+ */
+void clock_init(lv_obj_t *canvas, lv_color_t *cbuf);
+/* Repaint every digit, after the canvas has been redrawn and rotated */
+void clock_draw(void);
+void clock_set(int64_t unix_seconds, int16_t utc_offset_min);
@@ -0,0 +1,209 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "dither.h"
+#include "scratch.h"
+
+#define DITHER_MAX_WIDTH 160
+/* One decoded 4bpp row plus a word of zero padding for the last sys_get_le32() */
+#define DITHER_ROW_SIZE (DITHER_MAX_WIDTH / 2 + sizeof(uint32_t))
+
+SCRATCH_RESERVE("dither", DITHER_ROW_SIZE);
+
+/* Threshold matrices, 0-15, rows of 8 (4x4 patterns are repeated across the row) */
+static const uint8_t patterns[DITHER_PATTERN_COUNT][8][8] = {
+    [DITHER_BAYER4] =
+        {
+            {0, 8, 2, 10, 0, 8, 2, 10},
+            {12, 4, 14, 6, 12, 4, 14, 6},
+            {3, 11, 1, 9, 3, 11, 1, 9},
+            {15, 7, 13, 5, 15, 7, 13, 5},
+            {0, 8, 2, 10, 0, 8, 2, 10},
+            {12, 4, 14, 6, 12, 4, 14, 6},
+            {3, 11, 1, 9, 3, 11, 1, 9},
+            {15, 7, 13, 5, 15, 7, 13, 5},
+        },
+    [DITHER_CLUSTER4] =
+        {
+            {12, 5, 6, 13, 12, 5, 6, 13},
+            {4, 0, 1, 7, 4, 0, 1, 7},
+            {11, 3, 2, 8, 11, 3, 2, 8},
+            {15, 10, 9, 14, 15, 10, 9, 14},
+            {12, 5, 6, 13, 12, 5, 6, 13},
+            {4, 0, 1, 7, 4, 0, 1, 7},
+            {11, 3, 2, 8, 11, 3, 2, 8},
+            {15, 10, 9, 14, 15, 10, 9, 14},
+        },
+    [DITHER_DIAGONAL] =
+        {
+            {0, 2, 4, 6, 9, 11, 13, 15},
+            {3, 4, 6, 8, 10, 13, 15, 1},
+            {5, 7, 8, 10, 12, 14, 1, 3},
+            {7, 9, 11, 12, 14, 0, 2, 5},
+            {9, 11, 13, 15, 0, 2, 4, 6},
+            {10, 13, 15, 1, 3, 4, 6, 8},
+            {12, 14, 1, 3, 5, 7, 8, 10},
+            {14, 0, 2, 5, 7, 9, 11, 12},
+        },
+    [DITHER_THRESHOLD] =
+        {
+            {7, 7, 7, 7, 7, 7, 7, 7},
+            {7, 7, 7, 7, 7, 7, 7, 7},
+            {7, 7, 7, 7, 7, 7, 7, 7},
+            {7, 7, 7, 7, 7, 7, 7, 7},
+            {7, 7, 7, 7, 7, 7, 7, 7},
+            {7, 7, 7, 7, 7, 7, 7, 7},
+            {7, 7, 7, 7, 7, 7, 7, 7},
+            {7, 7, 7, 7, 7, 7, 7, 7},
+        },
+};
+
+static enum dither_pattern pattern = CONFIG_NICE_VIEW_ART_GRAY4_PATTERN;
+static int8_t bias = CONFIG_NICE_VIEW_ART_GRAY4_BIAS;
+
+struct packbits {
+    const uint8_t *src;
+    const uint8_t *end;
+    uint8_t count;
+    bool repeat;
+};
+
+static int packbits_read(struct packbits *pb, uint8_t *out, size_t len) {
+    while (len > 0) {
+        if (pb->count == 0) {
+            if (pb->src >= pb->end) {
+                return -EINVAL;
+            }
+
+            int8_t header = (int8_t)*pb->src++;
+            if (header == -128) {
+                continue;
+            }
+
+            pb->repeat = header < 0;
+            pb->count = pb->repeat ? 1 - header : header + 1;
+        }
+
+        size_t n = MIN(len, pb->count);
+        if (pb->src + (pb->repeat ? 1 : n) > pb->end) {
+            return -EINVAL;
+        }
+
+        if (pb->repeat) {
+            memset(out, *pb->src, n);
+        } else {
+            memcpy(out, pb->src, n);
+            pb->src += n;
+        }
+
+        out += n;
+        len -= n;
+        pb->count -= n;
+        if (pb->repeat && pb->count == 0) {
+            pb->src++;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Threshold words for one row. Lane k of the high word is compared with pixel
+ * 2k of an 8 pixel group and lane k of the low word with pixel 2k + 1. A pixel
+ * is white when its level reaches the threshold, so thresholds run 1-15 to
+ * keep level 0 fully black and level 15 fully white before bias is applied.
+ */
+static void row_thresholds(int y, uint32_t *t_hi, uint32_t *t_lo) {
+    const uint8_t *row = patterns[pattern][y % 8];
+
+    *t_hi = 0;
+    *t_lo = 0;
+    for (int k = 0; k < 4; k++) {
+        int hi = 1 + (row[2 * k] * 14 + 7) / 15 - bias;
+        int lo = 1 + (row[2 * k + 1] * 14 + 7) / 15 - bias;
+        *t_hi |= (uint32_t)CLAMP(hi, 0, 16) << (8 * k);
+        *t_lo |= (uint32_t)CLAMP(lo, 0, 16) << (8 * k);
+    }
+}
+
+/*
+ * Dither 8 pixels at once. Each nibble is moved into its own byte lane with
+ * bit 4 set, so subtracting a threshold of at most 16 never borrows across
+ * lanes and leaves bit 4 set exactly when level >= threshold. The multiply
+ * gathers the four lane bits of each word into alternating output bits.
+ */
+static inline uint8_t dither8(uint32_t px, uint32_t t_hi, uint32_t t_lo) {
+    uint32_t hi = (((((px >> 4) & 0x0F0F0F0F) | 0x10101010) - t_hi) >> 4) & 0x01010101;
+    uint32_t lo = ((((px & 0x0F0F0F0F) | 0x10101010) - t_lo) >> 4) & 0x01010101;
+
+    return (((hi * 0x80200802) >> 24) & 0xAA) | (((lo * 0x80200802) >> 25) & 0x55);
+}
+
+static int dither_rows(const struct gray_art *art, uint8_t *dst, size_t stride, uint8_t *row) {
+    size_t row_bytes = DIV_ROUND_UP(art->width, 2);
+    struct packbits pb = {.src = art->data, .end = art->data + art->data_size};
+    uint32_t t_hi, t_lo;
+
+    memset(row, 0, DITHER_ROW_SIZE);
+
+    for (int y = 0; y < art->height; y++) {
+        if (art->flags & GRAY_ART_PACKBITS) {
+            int err = packbits_read(&pb, row, row_bytes);
+            if (err) {
+                LOG_ERR("Corrupt grayscale art at row %d", y);
+                return err;
+            }
+        } else {
+            if (art->data_size < (y + 1) * row_bytes) {
+                return -EINVAL;
+            }
+            memcpy(row, &art->data[y * row_bytes], row_bytes);
+        }
+
+        /* Padding past the row end stays zero and dithers to black */
+        memset(&row[row_bytes], 0, DITHER_ROW_SIZE - row_bytes);
+
+        row_thresholds(y, &t_hi, &t_lo);
+        for (int x = 0; x < art->width; x += 8) {
+            dst[x / 8] = dither8(sys_get_le32(&row[x / 2]), t_hi, t_lo);
+        }
+        dst += stride;
+    }
+
+    return 0;
+}
+
+int dither_art(const struct gray_art *art, uint8_t *dst, size_t stride) {
+    if (art->width > DITHER_MAX_WIDTH || stride < DIV_ROUND_UP(art->width, 8)) {
+        return -EINVAL;
+    }
+
+    size_t mark = scratch_mark();
+    uint8_t *row = scratch_alloc("dither", DITHER_ROW_SIZE);
+    int err = row != NULL ? dither_rows(art, dst, stride, row) : -ENOMEM;
+
+    scratch_release(mark);
+    return err;
+}
+
+void dither_set_pattern(enum dither_pattern new_pattern) {
+    if (new_pattern < DITHER_PATTERN_COUNT) {
+        pattern = new_pattern;
+    }
+}
+
+enum dither_pattern dither_get_pattern(void) { return pattern; }
+
+void dither_set_bias(int8_t new_bias) { bias = CLAMP(new_bias, -8, 8); }
+
+int8_t dither_get_bias(void) { return bias; }
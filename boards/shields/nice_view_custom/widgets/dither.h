@@ -0,0 +1,46 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/* gray_art.flags: data is PackBits compressed */
+#define GRAY_ART_PACKBITS BIT(0)
+
+/*
+ * 4bpp grayscale image, two pixels per byte with the left pixel in the high
+ * nibble, 0 black to 15 white. Rows are padded to whole bytes.
+ */
+struct gray_art {
+    uint16_t width;
+    uint16_t height;
+    uint8_t flags;
+    uint32_t data_size;
+    const uint8_t *data;
+};
+
+enum dither_pattern {
+    DITHER_BAYER4,
+    DITHER_CLUSTER4,
+    DITHER_DIAGONAL,
+    DITHER_THRESHOLD,
+    DITHER_PATTERN_COUNT,
+};
+
+void dither_set_pattern(enum dither_pattern pattern);
+enum dither_pattern dither_get_pattern(void);
+
+/* Positive bias brightens, negative darkens; range -8 to 8 */
+void dither_set_bias(int8_t bias);
+int8_t dither_get_bias(void);
+
+/*
+ * Decode `art` and write it to `dst` as 1bpp rows, MSB first, 1 for white,
+ * `stride` bytes apart.
+ */
+int dither_art(const struct gray_art *art, uint8_t *dst, size_t stride);
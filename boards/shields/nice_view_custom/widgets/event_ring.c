@@ -0,0 +1,144 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/linker/section_tags.h>
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+#include <lvgl_mem.h>
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "event_ring.h"
+
+#define EVENT_RING_SIZE CONFIG_NICE_VIEW_WIDGET_EVENT_RING_SIZE
+#define EVENT_RING_MAGIC 0x4e564552 /* "NVER" */
+
+BUILD_ASSERT(IS_POWER_OF_TWO(EVENT_RING_SIZE), "Event ring size must be a power of two");
+BUILD_ASSERT(sizeof(struct event_ring_entry) == 16, "Event ring entries should stay 16 bytes");
+
+/* Survives a warm reset; checked against the magic and the entry layout at boot */
+static __noinit struct {
+    uint32_t magic;
+    uint32_t layout;
+    uint32_t head;
+    struct event_ring_entry entries[EVENT_RING_SIZE];
+} ring;
+
+#define EVENT_RING_LAYOUT (sizeof(ring.entries) ^ (EVENT_RING_TYPE_COUNT << 24))
+
+static uint16_t heap_free = UINT16_MAX;
+
+static const char *const type_names[EVENT_RING_TYPE_COUNT] = {
+    [EVENT_RING_BOOT] = "boot",     [EVENT_RING_RENDER] = "render",
+    [EVENT_RING_FLUSH] = "flush",   [EVENT_RING_CLEAR] = "clear",
+    [EVENT_RING_REFRESH] = "refresh", [EVENT_RING_SLIDE] = "slide",
+    [EVENT_RING_PARK] = "park",     [EVENT_RING_RESUME] = "resume",
+};
+
+/*
+ * Free bytes in LVGL's sys_heap pool (Zephyr's default LVGL allocator); with
+ * the libc heap there is nothing to ask and the field stays unknown. Sampled
+ * once per refresh, never per event.
+ */
+static void sample_heap(void) {
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+    struct sys_memory_stats stats;
+
+    lvgl_heap_stats(&stats);
+    heap_free = MIN(stats.free_bytes, UINT16_MAX - 1);
+#endif
+}
+
+void event_ring_record(enum event_ring_type type, uint8_t tag, const lv_area_t *area,
+                       uint32_t duration_us) {
+    struct event_ring_entry *entry = &ring.entries[ring.head++ & (EVENT_RING_SIZE - 1)];
+
+    if (type == EVENT_RING_REFRESH) {
+        sample_heap();
+    }
+
+    entry->ms = k_uptime_get_32();
+    entry->duration_us = duration_us;
+    entry->type = type;
+    entry->tag = tag;
+    if (area != NULL) {
+        entry->x1 = CLAMP(area->x1, 0, UINT8_MAX);
+        entry->y1 = CLAMP(area->y1, 0, UINT8_MAX);
+        entry->x2 = CLAMP(area->x2, 0, UINT8_MAX);
+        entry->y2 = CLAMP(area->y2, 0, UINT8_MAX);
+    } else {
+        entry->x1 = entry->y1 = 0;
+        entry->x2 = entry->y2 = UINT8_MAX;
+    }
+    entry->heap_free = heap_free;
+}
+
+bool event_ring_get(size_t index, struct event_ring_entry *entry) {
+    uint32_t count = MIN(ring.head, EVENT_RING_SIZE);
+
+    if (index >= count) {
+        return false;
+    }
+
+    *entry = ring.entries[(ring.head - count + index) & (EVENT_RING_SIZE - 1)];
+    return true;
+}
+
+static int event_ring_init(void) {
+    if (ring.magic != EVENT_RING_MAGIC || ring.layout != EVENT_RING_LAYOUT) {
+        memset(&ring, 0, sizeof(ring));
+        ring.magic = EVENT_RING_MAGIC;
+        ring.layout = EVENT_RING_LAYOUT;
+    } else if (ring.head > 0) {
+        LOG_INF("Display event ring kept %u events from before the reset",
+                MIN(ring.head, EVENT_RING_SIZE));
+    }
+
+    event_ring_record(EVENT_RING_BOOT, 0, NULL, 0);
+
+    return 0;
+}
+
+SYS_INIT(event_ring_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#if IS_ENABLED(CONFIG_SHELL)
+#include <stdlib.h>
+#include <zephyr/shell/shell.h>
+
+static int cmd_events(const struct shell *sh, size_t argc, char **argv) {
+    struct event_ring_entry entry;
+    size_t count = MIN(ring.head, EVENT_RING_SIZE);
+    size_t first = 0;
+
+    if (argc > 1) {
+        size_t last = strtoul(argv[1], NULL, 10);
+        first = count > last ? count - last : 0;
+    }
+
+    shell_print(sh, "%10s %-8s %4s %15s %10s %6s", "ms", "event", "tag", "area", "us", "heap");
+    for (size_t i = first; event_ring_get(i, &entry); i++) {
+        shell_print(sh, "%10u %-8s %4u %3u,%-3u-%3u,%-3u %10u %6u", entry.ms,
+                    entry.type < EVENT_RING_TYPE_COUNT ? type_names[entry.type] : "?", entry.tag,
+                    entry.x1, entry.y1, entry.x2, entry.y2, entry.duration_us, entry.heap_free);
+    }
+
+    return 0;
+}
+
+static int cmd_events_clear(const struct shell *sh, size_t argc, char **argv) {
+    ring.head = 0;
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((nice_view), events, NULL, "Dump display events [last N]", cmd_events, 1, 1);
+SHELL_SUBCMD_ADD((nice_view), clear_events, NULL, "Forget display events", cmd_events_clear, 1,
+                 0);
+#endif
@@ -0,0 +1,51 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+enum event_ring_type {
+    EVENT_RING_BOOT,
+    /* tag: NICE_VIEW_INPUT_* mask served, duration: render cost */
+    EVENT_RING_RENDER,
+    /* Rows handed to the panel driver, duration: driver write */
+    EVENT_RING_FLUSH,
+    EVENT_RING_CLEAR,
+    /* LVGL refresh, duration: refresh time; samples the LVGL heap */
+    EVENT_RING_REFRESH,
+    /* tag: slide index, duration: decode */
+    EVENT_RING_SLIDE,
+    EVENT_RING_PARK,
+    EVENT_RING_RESUME,
+    EVENT_RING_TYPE_COUNT,
+};
+
+/* 16 bytes; the area is clipped to the panel */
+struct event_ring_entry {
+    uint32_t ms;
+    uint32_t duration_us;
+    uint8_t type;
+    uint8_t tag;
+    uint8_t x1, y1, x2, y2;
+    /* LVGL heap free at the last refresh, UINT16_MAX when unknown */
+    uint16_t heap_free;
+};
+
+/*
+ * The last CONFIG_NICE_VIEW_WIDGET_EVENT_RING_SIZE display events, kept in
+ * RAM that is not cleared on a warm reset, so the events that led up to a
+ * freeze or a watchdog reset can be read back afterwards (`nice_view events`
+ * in the shell). Display work queue only; a record is a handful of stores.
+ * `area` may be NULL for the whole panel.
+ */
+void event_ring_record(enum event_ring_type type, uint8_t tag, const lv_area_t *area,
+                       uint32_t duration_us);
+
+/* Oldest first; returns false past the newest entry */
+bool event_ring_get(size_t index, struct event_ring_entry *entry);
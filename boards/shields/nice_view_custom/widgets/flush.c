@@ -0,0 +1,461 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <lvgl.h>
+#include <stdio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/settings/settings.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+#include "event_ring.h"
+#endif
+#include "bitops.h"
+#include "flush.h"
+#include "mirror.h"
+#include "scratch.h"
+
+enum flush_option {
+    OPTION_INVERTED,
+    OPTION_FLIPPED,
+};
+
+static const char *const option_names[] = {
+    [OPTION_INVERTED] = "inverted",
+    [OPTION_FLIPPED] = "flipped",
+};
+
+/* Requested state, one bit per option, written from any thread */
+static atomic_t requested =
+    ATOMIC_INIT((IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) << OPTION_INVERTED) |
+                (IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_FLIPPED) << OPTION_FLIPPED));
+
+/* Applied state, only touched on the display work queue so a frame is never half converted */
+static bool inverted = IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED);
+static bool flipped = IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_FLIPPED);
+
+static struct display_flush_overlay overlay;
+
+static void (*next_flush_cb)(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+
+static bool panel_ready;
+static struct k_work_delayable *ready_work;
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PANEL_CLEAR)
+#define PANEL_NODE DT_CHOSEN(zephyr_display)
+
+/* Same bus settings as the ls0xx driver */
+#define PANEL_SPI_OP                                                                               \
+    (SPI_OP_MODE_MASTER | SPI_WORD_SET(8) | SPI_TRANSFER_LSB | SPI_CS_ACTIVE_HIGH |                \
+     SPI_HOLD_ON_CS | SPI_LOCK_ON)
+
+/* LS0xx all-clear: mode byte with M2 set, then a dummy byte */
+#define PANEL_CMD_CLEAR 0x04
+
+#define PANEL_ROW_BYTES DIV_ROUND_UP(DT_PROP(PANEL_NODE, width), 8)
+
+SCRATCH_RESERVE("panel_clear", PANEL_ROW_BYTES * DT_PROP(PANEL_NODE, height));
+
+static const struct device *const panel = DEVICE_DT_GET(PANEL_NODE);
+static const struct spi_dt_spec panel_spi = SPI_DT_SPEC_GET(PANEL_NODE, PANEL_SPI_OP, 0);
+
+/* Blank rows 0..held_end reached the flush but have not been sent yet */
+static int held_end = -1;
+static uint32_t saved_rows;
+
+static bool is_blank(const uint8_t *buf, size_t len) {
+    size_t i = 0;
+
+    if (IS_PTR_ALIGNED(buf, uint32_t)) {
+        for (; i + sizeof(uint32_t) <= len; i += sizeof(uint32_t)) {
+            if (*(const uint32_t *)&buf[i] != UINT32_MAX) {
+                return false;
+            }
+        }
+    }
+    for (; i < len; i++) {
+        if (buf[i] != UINT8_MAX) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static int panel_clear(void) {
+    uint8_t cmd[2] = {PANEL_CMD_CLEAR, 0};
+    const struct spi_buf buf = {.buf = cmd, .len = sizeof(cmd)};
+    const struct spi_buf_set tx = {.buffers = &buf, .count = 1};
+
+    int err = spi_write_dt(&panel_spi, &tx);
+    spi_release_dt(&panel_spi);
+
+    return err;
+}
+
+/*
+ * Send the held blank rows as ordinary row writes. They always run from the
+ * top row down, so they go out as one multi-row write of white rows, or one
+ * row per write if the scratch arena is in use. `last` is true when these are
+ * the final rows written for the current LVGL refresh.
+ */
+static void write_held_rows(lv_disp_drv_t *drv, bool last) {
+    uint8_t one_row[PANEL_ROW_BYTES];
+    size_t row_bytes = MIN(DIV_ROUND_UP(drv->hor_res, 8), sizeof(one_row));
+    int rows = held_end + 1;
+    int y = flipped ? drv->ver_res - rows : 0;
+    size_t mark = scratch_mark();
+    uint8_t *white = scratch_alloc("panel_clear", row_bytes * rows);
+    int step = rows;
+
+    if (white == NULL) {
+        white = one_row;
+        step = 1;
+    }
+
+    const struct display_buffer_descriptor desc = {
+        .buf_size = row_bytes * step,
+        .width = drv->hor_res,
+        .height = step,
+        .pitch = drv->hor_res,
+    };
+
+    memset(white, UINT8_MAX, desc.buf_size);
+    for (int i = 0; i < rows; i += step) {
+        display_write(panel, 0, y + i, &desc, white);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_MIRROR)
+        display_mirror_rows(y + i, step, row_bytes, white, last && i + step >= rows);
+#endif
+    }
+
+    scratch_release(mark);
+    held_end = -1;
+}
+
+/*
+ * A frame that ends up all white from the top row down is held back chunk by
+ * chunk; once it reaches the bottom row, a single clear command replaces all
+ * of its row writes. Inverted frames are white-on-black and never qualify.
+ * Returns true when the chunk was consumed.
+ */
+static bool clear_fast_path(lv_disp_drv_t *drv, const lv_area_t *area, const uint8_t *buf,
+                            size_t len) {
+    bool candidate = !inverted && area->x1 == 0 && area->x2 == drv->hor_res - 1 &&
+                     drv->hor_res % 8 == 0 && device_is_ready(panel);
+
+    if (candidate && area->y1 == held_end + 1 && is_blank(buf, len)) {
+        held_end = area->y2;
+
+        if (held_end == drv->ver_res - 1) {
+            if (panel_clear() == 0) {
+                saved_rows += drv->ver_res;
+                held_end = -1;
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_MIRROR)
+                display_mirror_clear();
+#endif
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+                event_ring_record(EVENT_RING_CLEAR, 0, NULL, 0);
+#endif
+                LOG_DBG("Panel cleared by command, %u row writes saved so far", saved_rows);
+            } else {
+                write_held_rows(drv, lv_disp_flush_is_last(drv));
+            }
+        } else if (lv_disp_flush_is_last(drv)) {
+            /* A blank area that does not reach the bottom: nothing more is coming */
+            write_held_rows(drv, true);
+        }
+
+        lv_disp_flush_ready(drv);
+        return true;
+    }
+
+    /* The chunk that ended the blank run is written after these rows */
+    if (held_end >= 0) {
+        write_held_rows(drv, false);
+    }
+
+    return false;
+}
+#endif
+
+static void invert(uint8_t *buf, size_t len) {
+    size_t i = 0;
+
+    if (IS_PTR_ALIGNED(buf, uint32_t)) {
+        for (; i + sizeof(uint32_t) <= len; i += sizeof(uint32_t)) {
+            *(uint32_t *)&buf[i] ^= UINT32_MAX;
+        }
+    }
+    for (; i < len; i++) {
+        buf[i] ^= UINT8_MAX;
+    }
+}
+
+void display_flush_overlay_apply(const struct display_flush_overlay *overlay, uint8_t *buf,
+                                 size_t row_bytes, int y1, int y2) {
+    size_t full = overlay->width / 8;
+    uint8_t mask = BIT_MASK(overlay->width % 8);
+    int first = MAX(y1, 0);
+    int last = MIN(y2, overlay->height - 1);
+
+    if (row_bytes < DIV_ROUND_UP(overlay->width, 8)) {
+        return;
+    }
+
+    for (int y = first; y <= last; y++) {
+        const uint8_t *src = &overlay->rows[y * overlay->stride];
+        uint8_t *dst = &buf[(y - y1) * row_bytes];
+
+        memcpy(dst, src, full);
+        if (mask) {
+            dst[full] = (dst[full] & ~mask) | (src[full] & mask);
+        }
+    }
+}
+
+/*
+ * Turn the chunk upside down in place: rows swap end for end and each row's
+ * pixels reverse. Rows must be whole words, which the 160 px panel rows are.
+ */
+static bool flip(uint8_t *buf, size_t row_bytes, int rows) {
+    if (row_bytes % sizeof(uint32_t) != 0) {
+        return false;
+    }
+
+    for (int i = 0, j = rows - 1; i <= j; i++, j--) {
+        uint8_t *a = &buf[i * row_bytes];
+        uint8_t *b = &buf[j * row_bytes];
+
+        bitops_reverse_row(a, row_bytes);
+        if (i == j) {
+            break;
+        }
+        bitops_reverse_row(b, row_bytes);
+
+        for (size_t k = 0; k < row_bytes; k++) {
+            uint8_t tmp = a[k];
+            a[k] = b[k];
+            b[k] = tmp;
+        }
+    }
+
+    return true;
+}
+
+/* The queued work runs after this flush returns, so it sees the first frame sent */
+static void note_first_frame(lv_disp_drv_t *drv) {
+    if (panel_ready || !lv_disp_flush_is_last(drv)) {
+        return;
+    }
+
+    panel_ready = true;
+    if (ready_work != NULL) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), ready_work, K_NO_WAIT);
+        ready_work = NULL;
+    }
+}
+
+/* The buffer holds whole 1bpp rows, already packed by the driver's set_px callback */
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    size_t row_bytes = DIV_ROUND_UP(lv_area_get_width(area), 8);
+    size_t len = row_bytes * lv_area_get_height(area);
+
+    note_first_frame(drv);
+
+    if (overlay.rows != NULL && area->x1 == 0) {
+        display_flush_overlay_apply(&overlay, (uint8_t *)color_p, row_bytes, area->y1, area->y2);
+    }
+
+    if (inverted) {
+        invert((uint8_t *)color_p, len);
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PANEL_CLEAR)
+    if (clear_fast_path(drv, area, (const uint8_t *)color_p, len)) {
+        return;
+    }
+#endif
+
+    lv_area_t panel_area = *area;
+
+    if (flipped && area->x1 == 0 && area->x2 == drv->hor_res - 1 &&
+        flip((uint8_t *)color_p, row_bytes, lv_area_get_height(area))) {
+        panel_area.y1 = drv->ver_res - 1 - area->y2;
+        panel_area.y2 = drv->ver_res - 1 - area->y1;
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_MIRROR)
+    /* Exactly the rows the panel is about to get */
+    if (area->x1 == 0 && area->x2 == drv->hor_res - 1) {
+        display_mirror_rows(panel_area.y1, lv_area_get_height(&panel_area), row_bytes,
+                            (const uint8_t *)color_p, lv_disp_flush_is_last(drv));
+    }
+#endif
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+    uint32_t start = k_cycle_get_32();
+    next_flush_cb(drv, &panel_area, color_p);
+    event_ring_record(EVENT_RING_FLUSH, 0, &panel_area,
+                      k_cyc_to_us_floor32(k_cycle_get_32() - start));
+#else
+    next_flush_cb(drv, &panel_area, color_p);
+#endif
+}
+
+/* Display work queue only; returns true when the applied state changed */
+static bool apply_requested(void) {
+    bool new_inverted = atomic_test_bit(&requested, OPTION_INVERTED);
+    bool new_flipped = atomic_test_bit(&requested, OPTION_FLIPPED);
+
+    if (new_inverted == inverted && new_flipped == flipped) {
+        return false;
+    }
+
+    inverted = new_inverted;
+    flipped = new_flipped;
+    return true;
+}
+
+/* Either option changes every pixel, so both cost exactly one full-panel flush */
+static void apply_work_cb(struct k_work *work) {
+    if (apply_requested() && zmk_display_is_initialized()) {
+        lv_obj_invalidate(lv_scr_act());
+    }
+}
+
+static K_WORK_DEFINE(apply_work, apply_work_cb);
+
+static void request(enum flush_option option, bool value) {
+    atomic_set_bit_to(&requested, option, value);
+
+    /* Settings can load before the display queue runs; display_flush_init() applies them then */
+    int ret = k_work_submit_to_queue(zmk_display_work_q(), &apply_work);
+    if (ret < 0) {
+        LOG_DBG("Display %s applied once the display starts (%d)", option_names[option], ret);
+    }
+}
+
+#if IS_ENABLED(CONFIG_SETTINGS)
+static void save_work_cb(struct k_work *work) {
+    char key[32];
+
+    for (int i = 0; i < ARRAY_SIZE(option_names); i++) {
+        bool value = atomic_test_bit(&requested, i);
+
+        snprintf(key, sizeof(key), "nice_view/%s", option_names[i]);
+        int err = settings_save_one(key, &value, sizeof(value));
+        if (err < 0) {
+            LOG_ERR("Failed to save display setting %s (%d)", option_names[i], err);
+        }
+    }
+}
+
+static K_WORK_DELAYABLE_DEFINE(save_work, save_work_cb);
+
+static int display_flush_settings_set(const char *name, size_t len, settings_read_cb read_cb,
+                                      void *cb_arg) {
+    const char *next;
+    bool value;
+
+    for (int i = 0; i < ARRAY_SIZE(option_names); i++) {
+        if (!settings_name_steq(name, option_names[i], &next) || next != NULL) {
+            continue;
+        }
+
+        if (len != sizeof(value)) {
+            return -EINVAL;
+        }
+
+        int err = read_cb(cb_arg, &value, sizeof(value));
+        if (err < 0) {
+            return err;
+        }
+
+        request(i, value);
+        return 0;
+    }
+
+    return -ENOENT;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(nice_view, "nice_view", NULL, display_flush_settings_set, NULL,
+                               NULL);
+#endif
+
+static void set_option(enum flush_option option, bool value) {
+    request(option, value);
+
+#if IS_ENABLED(CONFIG_SETTINGS)
+    k_work_reschedule(&save_work, K_MSEC(CONFIG_ZMK_SETTINGS_SAVE_DEBOUNCE));
+#endif
+}
+
+void display_flush_set_inverted(bool value) { set_option(OPTION_INVERTED, value); }
+
+bool display_flush_is_inverted(void) { return atomic_test_bit(&requested, OPTION_INVERTED); }
+
+void display_flush_set_flipped(bool value) { set_option(OPTION_FLIPPED, value); }
+
+bool display_flush_is_flipped(void) { return atomic_test_bit(&requested, OPTION_FLIPPED); }
+
+uint32_t display_flush_get_saved_rows(void) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PANEL_CLEAR)
+    return saved_rows;
+#else
+    return 0;
+#endif
+}
+
+#if IS_ENABLED(CONFIG_SHELL) && IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PANEL_CLEAR)
+#include <zephyr/shell/shell.h>
+
+static int cmd_panel_clear(const struct shell *sh, size_t argc, char **argv) {
+    shell_print(sh, "row writes replaced by the clear command: %u", display_flush_get_saved_rows());
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((nice_view), panel_clear, NULL, "Row writes saved by the panel clear command",
+                 cmd_panel_clear, 1, 0);
+#endif
+
+void display_flush_set_overlay(const struct display_flush_overlay *new_overlay) {
+    if (new_overlay == NULL) {
+        overlay.rows = NULL;
+        return;
+    }
+
+    overlay = *new_overlay;
+}
+
+void display_flush_when_ready(struct k_work_delayable *work) {
+    if (panel_ready) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), work, K_NO_WAIT);
+    } else {
+        ready_work = work;
+    }
+}
+
+void display_flush_init(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+
+    if (disp == NULL || disp->driver->flush_cb == flush_cb) {
+        return;
+    }
+
+    next_flush_cb = disp->driver->flush_cb;
+    disp->driver->flush_cb = flush_cb;
+
+    /* Before the first frame, so a saved option is already in it */
+    apply_requested();
+}
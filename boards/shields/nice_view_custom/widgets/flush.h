@@ -0,0 +1,58 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/*
+ * Post-processing applied to every LVGL flush before it reaches the panel.
+ * Widgets always render in the normal palette and orientation; inversion is a
+ * single XOR pass over the flushed rows, and the 180 degree flip reverses the
+ * row order and the pixels within each row.
+ */
+void display_flush_init(void);
+
+/* Safe to call from any thread; takes effect with one full-panel flush and is saved to settings */
+void display_flush_set_inverted(bool inverted);
+bool display_flush_is_inverted(void);
+
+/* Same for turning the picture upside down, for halves mounted the other way round */
+void display_flush_set_flipped(bool flipped);
+bool display_flush_is_flipped(void);
+
+/*
+ * Display work queue only. Reschedules `work` to run right away once the panel
+ * has been handed the last chunk of its first frame, or at once if it already
+ * has. A caller can keep its own timeout pending on the same work as a cap.
+ */
+void display_flush_when_ready(struct k_work_delayable *work);
+
+/* Row writes replaced by the panel's clear command (CONFIG_NICE_VIEW_WIDGET_PANEL_CLEAR) */
+uint32_t display_flush_get_saved_rows(void);
+
+/*
+ * Rows copied over every flush from x = 0, already in the panel's row format
+ * (LSB first, 1 for white); see scripts/art_ls0xx.py. Pixels past `width` in
+ * the last byte are left alone.
+ */
+struct display_flush_overlay {
+    const uint8_t *rows;
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;
+};
+
+/*
+ * Display work queue only. The overlay is copied; pass NULL to remove it. The
+ * caller invalidates the covered area so the new rows get flushed.
+ */
+void display_flush_set_overlay(const struct display_flush_overlay *overlay);
+
+/* Copy the overlay rows that fall within rows y1..y2 of `buf`, `row_bytes` apart */
+void display_flush_overlay_apply(const struct display_flush_overlay *overlay, uint8_t *buf,
+                                 size_t row_bytes, int y1, int y2);
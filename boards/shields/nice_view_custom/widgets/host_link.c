@@ -0,0 +1,120 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/uart.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#include "host_link.h"
+
+#if !DT_HAS_CHOSEN(nice_view_host_link)
+#error "CONFIG_NICE_VIEW_WIDGET_HOST_LINK needs a nice-view,host-link chosen node"
+#endif
+
+#define HOST_LINK_LINE_MAX CONFIG_NICE_VIEW_WIDGET_HOST_LINK_LINE_MAX
+
+static const struct device *uart = DEVICE_DT_GET(DT_CHOSEN(nice_view_host_link));
+
+/*
+ * Complete lines wait here for the display work queue. When the host sends
+ * faster than they are handled the queue fills and further lines are dropped,
+ * so a chatty host costs at most one queued work item.
+ */
+K_MSGQ_DEFINE(host_link_lines, HOST_LINK_LINE_MAX, CONFIG_NICE_VIEW_WIDGET_HOST_LINK_QUEUE, 1);
+
+static sys_slist_t handlers = SYS_SLIST_STATIC_INIT(&handlers);
+
+/* Only touched from the UART interrupt */
+static char rx_line[HOST_LINK_LINE_MAX];
+static size_t rx_len;
+static bool rx_overflow;
+
+static atomic_t dropped;
+
+static void dispatch(const char *line) {
+    struct host_link_handler *handler;
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&handlers, handler, node) {
+        if (handler->command == line[0]) {
+            handler->handle(line[1] == ' ' ? &line[2] : &line[1]);
+            return;
+        }
+    }
+
+    LOG_DBG("Unknown host command '%c'", line[0]);
+}
+
+static void rx_work_cb(struct k_work *work) {
+    char line[HOST_LINK_LINE_MAX];
+
+    while (k_msgq_get(&host_link_lines, line, K_NO_WAIT) == 0) {
+        dispatch(line);
+    }
+
+    atomic_val_t lost = atomic_clear(&dropped);
+    if (lost > 0) {
+        LOG_WRN("Host link dropped %ld lines", (long)lost);
+    }
+}
+
+static K_WORK_DEFINE(rx_work, rx_work_cb);
+
+static void end_line(void) {
+    if (rx_len > 0 && !rx_overflow) {
+        rx_line[rx_len] = '\0';
+        if (k_msgq_put(&host_link_lines, rx_line, K_NO_WAIT) != 0) {
+            atomic_inc(&dropped);
+        }
+        k_work_submit_to_queue(zmk_display_work_q(), &rx_work);
+    }
+
+    rx_len = 0;
+    rx_overflow = false;
+}
+
+static void uart_isr(const struct device *dev, void *user_data) {
+    uint8_t c;
+
+    while (uart_irq_update(dev) && uart_irq_rx_ready(dev)) {
+        if (uart_fifo_read(dev, &c, 1) != 1) {
+            break;
+        }
+
+        if (c == '\n' || c == '\r') {
+            end_line();
+        } else if (rx_len < sizeof(rx_line) - 1) {
+            rx_line[rx_len++] = c;
+        } else {
+            /* Overlong lines are dropped whole rather than cut short */
+            rx_overflow = true;
+        }
+    }
+}
+
+void host_link_register(struct host_link_handler *handler) {
+    sys_slist_append(&handlers, &handler->node);
+}
+
+static int host_link_init(void) {
+    if (!device_is_ready(uart)) {
+        LOG_ERR("Host link UART not ready");
+        return -ENODEV;
+    }
+
+    uart_irq_callback_user_data_set(uart, uart_isr, NULL);
+    uart_irq_rx_enable(uart);
+
+    return 0;
+}
+
+SYS_INIT(host_link_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
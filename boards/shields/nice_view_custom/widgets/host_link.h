@@ -0,0 +1,29 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/*
+ * Line protocol spoken by scripts/nice_view_host.py over the USB CDC ACM port
+ * chosen as `nice-view,host-link`. Each line is one ASCII command letter, a
+ * space and its arguments, terminated by a newline:
+ *
+ *   T <unix seconds> <UTC offset in minutes>   set the clock
+ *   S <text>                                   set the host text, empty clears it
+ *   D <keep> <tail>                            keep `keep` characters of the host
+ *                                              text and replace the rest with `tail`
+ */
+struct host_link_handler {
+    sys_snode_t node;
+    char command;
+    /* Runs on the display work queue with the rest of the line */
+    void (*handle)(const char *args);
+};
+
+void host_link_register(struct host_link_handler *handler);
@@ -0,0 +1,120 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#include "host_link.h"
+#include "host_text.h"
+
+#define HOST_TEXT_MAX CONFIG_NICE_VIEW_WIDGET_HOST_TEXT_MAX_LEN
+
+/* Only used on the display work queue, like the host link handlers and rendering */
+static char text[HOST_TEXT_MAX + 1];
+static struct nice_view_widget *text_widget;
+static uint32_t received;
+static uint32_t changed;
+static bool layer_shown;
+
+/* Drop text the host has stopped refreshing */
+static void expire_work_cb(struct k_work *work) {
+    if (text[0] != '\0') {
+        LOG_DBG("Host text expired");
+        text[0] = '\0';
+        nice_view_widget_invalidate(text_widget);
+    }
+}
+
+static K_WORK_DELAYABLE_DEFINE(expire_work, expire_work_cb);
+
+/* Back to the host text after a layer change */
+static void layer_work_cb(struct k_work *work) {
+    layer_shown = false;
+    if (text[0] != '\0') {
+        nice_view_widget_invalidate(text_widget);
+    }
+}
+
+static K_WORK_DELAYABLE_DEFINE(layer_work, layer_work_cb);
+
+static void update(size_t keep, const char *tail) {
+    char next[sizeof(text)];
+
+    memcpy(next, text, keep);
+    strncpy(&next[keep], tail, sizeof(next) - 1 - keep);
+    next[sizeof(next) - 1] = '\0';
+
+    received++;
+    /* Any update, even an unchanged one, keeps the text up */
+    if (CONFIG_NICE_VIEW_WIDGET_HOST_TEXT_TIMEOUT_S > 0) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), &expire_work,
+                                    K_SECONDS(CONFIG_NICE_VIEW_WIDGET_HOST_TEXT_TIMEOUT_S));
+    }
+
+    if (strcmp(next, text) == 0) {
+        return;
+    }
+
+    strcpy(text, next);
+    changed++;
+    LOG_DBG("Host text \"%s\" (%u updates, %u changed)", text, received, changed);
+
+    nice_view_widget_invalidate(text_widget);
+}
+
+/* S <text>: replace the whole text, empty to clear it */
+static void set_command(const char *args) { update(0, args); }
+
+/* D <keep> <tail>: keep the first `keep` characters and replace the rest */
+static void delta_command(const char *args) {
+    char *tail;
+    unsigned long keep = strtoul(args, &tail, 10);
+
+    if (tail == args || keep > strlen(text)) {
+        LOG_WRN("Host text delta out of step, waiting for a full update");
+        return;
+    }
+
+    update(keep, *tail == ' ' ? tail + 1 : tail);
+}
+
+static struct host_link_handler set_handler = {
+    .command = 'S',
+    .handle = set_command,
+};
+
+static struct host_link_handler delta_handler = {
+    .command = 'D',
+    .handle = delta_command,
+};
+
+void host_text_init(struct nice_view_widget *widget) {
+    text_widget = widget;
+    widget->min_interval_ms = CONFIG_NICE_VIEW_WIDGET_HOST_TEXT_MIN_INTERVAL_MS;
+
+    nice_view_widget_register(widget);
+    host_link_register(&set_handler);
+    host_link_register(&delta_handler);
+}
+
+const char *host_text_get(void) { return text[0] != '\0' && !layer_shown ? text : NULL; }
+
+void host_text_show_layer(void) {
+    if (text[0] == '\0' || CONFIG_NICE_VIEW_WIDGET_HOST_TEXT_LAYER_MS == 0) {
+        return;
+    }
+
+    layer_shown = true;
+    k_work_reschedule_for_queue(zmk_display_work_q(), &layer_work,
+                                K_MSEC(CONFIG_NICE_VIEW_WIDGET_HOST_TEXT_LAYER_MS));
+}
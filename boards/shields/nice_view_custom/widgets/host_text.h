@@ -0,0 +1,24 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "scheduler.h"
+
+/*
+ * Short text pushed by the host, e.g. the playing track. `widget` redraws it
+ * and is given a minimum interval, so however fast the host sends updates
+ * they are coalesced into at most one redraw per interval.
+ */
+void host_text_init(struct nice_view_widget *widget);
+/*
+ * Current text, NULL when the host has not set any, when it has expired, or
+ * while a layer change is being shown
+ */
+const char *host_text_get(void);
+/* Give the band back to the layer name for a moment; display work queue */
+void host_text_show_layer(void);
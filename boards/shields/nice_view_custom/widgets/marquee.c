@@ -0,0 +1,228 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
+
+#include "marquee.h"
+#include "util.h"
+
+/* Blank columns between the end of the text and its next repetition */
+#define MARQUEE_GAP 16
+
+static atomic_t idle;
+static atomic_t wakes;
+static sys_slist_t marquees = SYS_SLIST_STATIC_INIT(&marquees);
+
+static uint16_t text_width(const lv_font_t *font, const char *text) {
+    lv_font_glyph_dsc_t glyph;
+    uint32_t i = 0;
+    uint16_t width = 0;
+
+    while (text[i] != '\0') {
+        uint32_t letter = _lv_txt_encoded_next(text, &i);
+        uint32_t next = _lv_txt_encoded_next(&text[i], NULL);
+        if (lv_font_get_glyph_dsc(font, &glyph, letter, next)) {
+            width += glyph.adv_w;
+        }
+    }
+
+    return width;
+}
+
+static void prerender(struct marquee *marquee) {
+    const lv_font_t *font = marquee->font;
+    lv_font_glyph_dsc_t glyph;
+    uint32_t i = 0;
+    int pen = 0;
+
+    memset(marquee->strip, 0, sizeof(marquee->strip));
+
+    while (marquee->text[i] != '\0') {
+        uint32_t letter = _lv_txt_encoded_next(marquee->text, &i);
+        uint32_t next = _lv_txt_encoded_next(&marquee->text[i], NULL);
+        if (!lv_font_get_glyph_dsc(font, &glyph, letter, next)) {
+            continue;
+        }
+
+        const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, letter);
+        int top = font->line_height - font->base_line - glyph.box_h - glyph.ofs_y;
+        uint8_t half = BIT(glyph.bpp - 1);
+        uint32_t bit = 0;
+
+        /* Glyph bitmaps are packed without row padding; keep pixels at least half covered */
+        for (int gy = 0; bitmap != NULL && gy < glyph.box_h; gy++) {
+            for (int gx = 0; gx < glyph.box_w; gx++, bit += glyph.bpp) {
+                uint8_t shift = 8 - glyph.bpp - (bit % 8);
+                uint8_t value = (bitmap[bit / 8] >> shift) & (BIT(glyph.bpp) - 1);
+                int x = pen + glyph.ofs_x + gx;
+                int y = top + gy;
+
+                if (value >= half && x >= 0 && x < MARQUEE_STRIP_WIDTH && y >= 0 &&
+                    y < MARQUEE_HEIGHT) {
+                    marquee->strip[y * MARQUEE_STRIP_STRIDE + x / 8] |= 0x80 >> (x % 8);
+                }
+            }
+        }
+
+        pen += glyph.adv_w;
+    }
+}
+
+/* Paint one view column; view column i is row i of the rotated canvas buffer */
+static void paint_column(struct marquee *marquee, int column) {
+    uint16_t period = marquee->width + MARQUEE_GAP;
+    uint16_t src = (marquee->offset + column) % period;
+    lv_color_t *dst = &marquee->cbuf[column * CANVAS_SIZE + (CANVAS_SIZE - 1 - marquee->y)];
+
+    for (int row = 0; row < MARQUEE_HEIGHT; row++) {
+        bool set = src < marquee->width &&
+                   (marquee->strip[row * MARQUEE_STRIP_STRIDE + src / 8] & (0x80 >> (src % 8)));
+        dst[-row] = set ? (LVGL_FOREGROUND) : (LVGL_BACKGROUND);
+    }
+}
+
+static void invalidate_band(struct marquee *marquee) {
+    lv_area_t area;
+
+    lv_obj_get_coords(marquee->canvas, &area);
+    area.x2 = area.x1 + CANVAS_SIZE - 1 - marquee->y;
+    area.x1 = area.x2 - (MARQUEE_HEIGHT - 1);
+    lv_obj_invalidate_area(marquee->canvas, &area);
+}
+
+void marquee_draw(struct marquee *marquee) {
+    if (marquee->width == 0) {
+        return;
+    }
+
+    for (int column = 0; column < CANVAS_SIZE; column++) {
+        paint_column(marquee, column);
+    }
+    invalidate_band(marquee);
+}
+
+static void marquee_step(struct nice_view_widget *widget) {
+    struct marquee *marquee = CONTAINER_OF(widget, struct marquee, widget);
+    uint16_t period = marquee->width + MARQUEE_GAP;
+    uint8_t step = CONFIG_NICE_VIEW_WIDGET_MARQUEE_STEP;
+
+    if (marquee->width == 0) {
+        return;
+    }
+
+    if (marquee->wakes != atomic_get(&wakes)) {
+        marquee->wakes = atomic_get(&wakes);
+        marquee->passes = 0;
+    }
+
+    /* Done scrolling: park at the start of the text and stop asking for frames */
+    if (marquee->passes >= CONFIG_NICE_VIEW_WIDGET_MARQUEE_PASSES || atomic_get(&idle)) {
+        if (marquee->offset != 0) {
+            marquee->offset = 0;
+            marquee_draw(marquee);
+        }
+        return;
+    }
+
+    marquee->offset += step;
+    if (marquee->offset >= period) {
+        marquee->offset -= period;
+        marquee->passes++;
+    }
+
+    /* Shift the band already in the canvas and paint only the columns scrolled in */
+    size_t band = CANVAS_SIZE - marquee->y - MARQUEE_HEIGHT;
+    for (int column = 0; column < CANVAS_SIZE - step; column++) {
+        memmove(&marquee->cbuf[column * CANVAS_SIZE + band],
+                &marquee->cbuf[(column + step) * CANVAS_SIZE + band],
+                MARQUEE_HEIGHT * sizeof(lv_color_t));
+    }
+    for (int column = CANVAS_SIZE - step; column < CANVAS_SIZE; column++) {
+        paint_column(marquee, column);
+    }
+    invalidate_band(marquee);
+
+    nice_view_widget_invalidate(widget);
+}
+
+void marquee_init(struct marquee *marquee, const char *name, lv_obj_t *canvas, lv_color_t *cbuf,
+                  const lv_font_t *font, lv_coord_t y) {
+    marquee->canvas = canvas;
+    marquee->cbuf = cbuf;
+    marquee->font = font;
+    marquee->y = y;
+    marquee->widget.name = name;
+    marquee->widget.min_interval_ms = 1000 / CONFIG_NICE_VIEW_WIDGET_MARQUEE_FPS;
+    marquee->widget.priority = UINT8_MAX - 1;
+    marquee->widget.budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US;
+    marquee->widget.render = marquee_step;
+    lv_obj_update_layout(canvas);
+    lv_obj_get_coords(canvas, &marquee->widget.region);
+    marquee->wakes = atomic_get(&wakes);
+
+    sys_slist_append(&marquees, &marquee->node);
+    nice_view_widget_register(&marquee->widget);
+}
+
+bool marquee_set_text(struct marquee *marquee, const char *text) {
+    if (strncmp(marquee->text, text, sizeof(marquee->text) - 1) == 0) {
+        if (marquee->width > 0 && marquee->passes >= CONFIG_NICE_VIEW_WIDGET_MARQUEE_PASSES) {
+            marquee->passes = 0;
+            nice_view_widget_invalidate(&marquee->widget);
+        }
+        return marquee->width > 0;
+    }
+
+    strncpy(marquee->text, text, sizeof(marquee->text) - 1);
+    marquee->offset = 0;
+    marquee->passes = 0;
+    marquee->width = text_width(marquee->font, marquee->text);
+
+    if (marquee->width <= CANVAS_SIZE) {
+        marquee->width = 0;
+        return false;
+    }
+
+    marquee->width = MIN(marquee->width, MARQUEE_STRIP_WIDTH);
+    prerender(marquee);
+    nice_view_widget_invalidate(&marquee->widget);
+
+    return true;
+}
+
+static int marquee_activity_listener(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+
+    if (ev == NULL) {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    bool was_idle = atomic_set(&idle, ev->state != ZMK_ACTIVITY_ACTIVE);
+
+    /* Back from idle: scroll clipped text again from the start */
+    if (was_idle && ev->state == ZMK_ACTIVITY_ACTIVE) {
+        struct marquee *marquee;
+
+        atomic_inc(&wakes);
+        SYS_SLIST_FOR_EACH_CONTAINER(&marquees, marquee, node) {
+            if (marquee->width > 0) {
+                nice_view_widget_invalidate(&marquee->widget);
+            }
+        }
+    }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(marquee_activity, marquee_activity_listener);
+ZMK_SUBSCRIPTION(marquee_activity, zmk_activity_state_changed);
@@ -0,0 +1,46 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+#include "scheduler.h"
+
+#define MARQUEE_TEXT_MAX 32
+#define MARQUEE_STRIP_WIDTH 256
+#define MARQUEE_HEIGHT 18
+#define MARQUEE_STRIP_STRIDE (MARQUEE_STRIP_WIDTH / 8)
+
+/*
+ * Scrolling text band inside one of the rotated 68x68 canvases. The text is
+ * prerendered once into a 1bpp strip; each step shifts the band already in the
+ * canvas buffer and paints only the newly exposed columns.
+ */
+struct marquee {
+    struct nice_view_widget widget;
+    sys_snode_t node;
+    lv_obj_t *canvas;
+    lv_color_t *cbuf;
+    const lv_font_t *font;
+    /* Top of the band in unrotated canvas coordinates */
+    lv_coord_t y;
+    char text[MARQUEE_TEXT_MAX];
+    /* Prerendered text width, 0 while the text fits and nothing scrolls */
+    uint16_t width;
+    uint16_t offset;
+    uint8_t passes;
+    /* Wake count the passes were counted from; a wake starts a new run */
+    atomic_val_t wakes;
+    uint8_t strip[MARQUEE_STRIP_STRIDE * MARQUEE_HEIGHT];
+};
+
+void marquee_init(struct marquee *marquee, const char *name, lv_obj_t *canvas, lv_color_t *cbuf,
+                  const lv_font_t *font, lv_coord_t y);
+/* Setting the same text again restarts a scroll that has stopped */
+bool marquee_set_text(struct marquee *marquee, const char *text);
+void marquee_draw(struct marquee *marquee);
@@ -0,0 +1,135 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/usb/class/usb_cdc.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#include "mirror.h"
+
+#if !DT_HAS_CHOSEN(nice_view_mirror)
+#error "CONFIG_NICE_VIEW_WIDGET_MIRROR needs a nice-view,mirror chosen node"
+#endif
+
+#if DT_HAS_CHOSEN(nice_view_host_link) &&                                                          \
+    DT_SAME_NODE(DT_CHOSEN(nice_view_mirror), DT_CHOSEN(nice_view_host_link))
+#error "The display mirror and the host link need separate CDC ACM ports"
+#endif
+
+#define MIRROR_HEADER_SIZE 10
+
+static const struct device *uart = DEVICE_DT_GET(DT_CHOSEN(nice_view_mirror));
+
+RING_BUF_DECLARE(mirror_ring, CONFIG_NICE_VIEW_WIDGET_MIRROR_BUFFER_SIZE);
+static struct k_spinlock lock;
+
+static uint32_t dropped;
+
+static bool host_listening(void) {
+    uint32_t dtr = 0;
+
+    return uart_line_ctrl_get(uart, UART_LINE_CTRL_DTR, &dtr) == 0 && dtr;
+}
+
+static void put_header(uint8_t type, int y, int rows, size_t row_bytes, uint8_t flags) {
+    uint8_t header[MIRROR_HEADER_SIZE] = {DISPLAY_MIRROR_MAGIC, type, y, rows, row_bytes, flags};
+
+    sys_put_le32(k_uptime_get_32(), &header[6]);
+    ring_buf_put(&mirror_ring, header, sizeof(header));
+}
+
+/* Queue a whole record or nothing; the display work queue is the only producer */
+static void record(uint8_t type, int y, int rows, size_t row_bytes, uint8_t flags,
+                   const uint8_t *payload, size_t len) {
+    uint8_t count[sizeof(uint32_t)];
+
+    if (!host_listening()) {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (dropped > 0 && ring_buf_space_get(&mirror_ring) >= MIRROR_HEADER_SIZE + sizeof(count)) {
+        sys_put_le32(dropped, count);
+        put_header('D', 0, 0, 0, 0);
+        ring_buf_put(&mirror_ring, count, sizeof(count));
+        dropped = 0;
+    }
+
+    if (ring_buf_space_get(&mirror_ring) < MIRROR_HEADER_SIZE + len) {
+        dropped++;
+    } else {
+        put_header(type, y, rows, row_bytes, flags);
+        ring_buf_put(&mirror_ring, payload, len);
+    }
+
+    k_spin_unlock(&lock, key);
+    uart_irq_tx_enable(uart);
+}
+
+void display_mirror_rows(int y, int rows, size_t row_bytes, const uint8_t *buf, bool last) {
+    record('R', y, rows, row_bytes, last ? DISPLAY_MIRROR_LAST : 0, buf, rows * row_bytes);
+}
+
+void display_mirror_clear(void) { record('C', 0, 0, 0, 0, NULL, 0); }
+
+static void uart_isr(const struct device *dev, void *user_data) {
+    while (uart_irq_update(dev) && uart_irq_tx_ready(dev)) {
+        k_spinlock_key_t key = k_spin_lock(&lock);
+        uint8_t *data;
+        uint32_t len = ring_buf_get_claim(&mirror_ring, &data, UINT32_MAX);
+        int sent = len > 0 ? uart_fifo_fill(dev, data, len) : 0;
+
+        ring_buf_get_finish(&mirror_ring, MAX(sent, 0));
+        k_spin_unlock(&lock, key);
+
+        if (len == 0) {
+            uart_irq_tx_disable(dev);
+            break;
+        }
+        if (sent <= 0) {
+            break;
+        }
+    }
+}
+
+/* A host just opened the port: send it a whole frame to start from */
+static void full_frame_work_cb(struct k_work *work) {
+    if (zmk_display_is_initialized()) {
+        lv_obj_invalidate(lv_scr_act());
+    }
+}
+
+static K_WORK_DEFINE(full_frame_work, full_frame_work_cb);
+
+static void dte_rate_cb(const struct device *dev, uint32_t rate) {
+    k_work_submit_to_queue(zmk_display_work_q(), &full_frame_work);
+}
+
+static int display_mirror_init(void) {
+    if (!device_is_ready(uart)) {
+        LOG_ERR("Display mirror UART not ready");
+        return -ENODEV;
+    }
+
+    uart_irq_callback_user_data_set(uart, uart_isr, NULL);
+    cdc_acm_dte_rate_callback_set(uart, dte_rate_cb);
+
+    return 0;
+}
+
+SYS_INIT(display_mirror_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,33 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/*
+ * Debug copy of everything sent to the panel, streamed over the USB CDC ACM
+ * port chosen as `nice-view,mirror` and read back by
+ * `scripts/nice_view_host.py <port> mirror`. Each record is a header
+ *
+ *   0xa5, type, first row, row count, row bytes, flags, ms (u32 LE)
+ *
+ * followed by the payload:
+ *
+ *   'R'  row count * row bytes of panel rows (LSB first, 1 for white),
+ *        flags bit 0 set on the last chunk of a refresh
+ *   'C'  none, the panel was cleared to white
+ *   'D'  u32 LE count of records dropped because the host fell behind
+ *
+ * Nothing is recorded while no host has the port open, and a record that does
+ * not fit the buffer is dropped whole, so the flush never waits for USB.
+ */
+#define DISPLAY_MIRROR_MAGIC 0xa5
+#define DISPLAY_MIRROR_LAST BIT(0)
+
+void display_mirror_rows(int y, int rows, size_t row_bytes, const uint8_t *buf, bool last);
+void display_mirror_clear(void);
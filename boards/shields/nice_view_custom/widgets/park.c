@@ -0,0 +1,171 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+#include "event_ring.h"
+#endif
+#include "park.h"
+#include "scheduler.h"
+
+/*
+ * Crescent moon shown in the parked frame. It sits in the status strip right
+ * of x = 140, between the battery and the output symbol, because the LS0xx
+ * art overlay overwrites everything left of that at flush time.
+ */
+#define PARK_INDICATOR_X 143
+#define PARK_INDICATOR_Y 30
+
+static const uint8_t moon_map[] = {
+    0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
+    0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
+
+    0xff, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xe3, 0xff, 0xc3, 0xff, 0x83, 0xff, 0x83, 0xff,
+    0x83, 0xff, 0x81, 0xff, 0x80, 0xfd, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07, 0xf0, 0x0f,
+    0xf8, 0x1f, 0xff, 0xff,
+};
+
+static const lv_img_dsc_t moon = {
+    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 16,
+    .header.h = 16,
+    .data_size = sizeof(moon_map),
+    .data = moon_map,
+};
+
+static sys_slist_t hooks = SYS_SLIST_STATIC_INIT(&hooks);
+static lv_obj_t *park_screen;
+static lv_obj_t *indicator;
+static bool parked;
+
+static K_SEM_DEFINE(parked_sem, 0, 1);
+
+/* Display work queue: draw the parked frame and push it out in one refresh */
+static void park(void) {
+    struct nice_view_park_hook *hook;
+
+    if (parked || park_screen == NULL) {
+        return;
+    }
+
+    parked = true;
+    nice_view_sched_suspend();
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&hooks, hook, node) {
+        if (hook->park != NULL) {
+            hook->park(hook);
+        }
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK_INDICATOR)
+    indicator = lv_img_create(park_screen);
+    lv_img_set_src(indicator, &moon);
+    lv_obj_align(indicator, LV_ALIGN_TOP_LEFT, PARK_INDICATOR_X, PARK_INDICATOR_Y);
+#endif
+
+    /* Display updates are already stopped for sleep, so refresh by hand */
+    lv_refr_now(NULL);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+    event_ring_record(EVENT_RING_PARK, 0, NULL, 0);
+#endif
+    LOG_DBG("Display parked");
+}
+
+static void resume(void) {
+    struct nice_view_park_hook *hook;
+
+    if (!parked) {
+        return;
+    }
+
+    if (indicator != NULL) {
+        lv_obj_del(indicator);
+        indicator = NULL;
+    }
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&hooks, hook, node) {
+        if (hook->resume != NULL) {
+            hook->resume(hook);
+        }
+    }
+
+    parked = false;
+    nice_view_sched_resume();
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+    event_ring_record(EVENT_RING_RESUME, 0, NULL, 0);
+#endif
+    LOG_DBG("Display resumed");
+}
+
+static void park_work_cb(struct k_work *work) {
+    park();
+    k_sem_give(&parked_sem);
+}
+
+static void resume_work_cb(struct k_work *work) { resume(); }
+
+static K_WORK_DEFINE(park_work, park_work_cb);
+static K_WORK_DEFINE(resume_work, resume_work_cb);
+
+static bool on_display_queue(void) {
+    return k_current_get() == k_work_queue_thread_get(zmk_display_work_q());
+}
+
+/*
+ * The sleep event is raised right before the SoC powers off, so wait (briefly)
+ * for the parked frame to reach the panel before letting it go ahead.
+ */
+static int park_listener(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+
+    if (ev == NULL) {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    switch (ev->state) {
+    case ZMK_ACTIVITY_SLEEP:
+        if (on_display_queue()) {
+            park();
+            break;
+        }
+
+        k_sem_reset(&parked_sem);
+        k_work_submit_to_queue(zmk_display_work_q(), &park_work);
+        if (k_sem_take(&parked_sem, K_MSEC(CONFIG_NICE_VIEW_WIDGET_PARK_TIMEOUT_MS)) != 0) {
+            LOG_WRN("Display not parked within %d ms", CONFIG_NICE_VIEW_WIDGET_PARK_TIMEOUT_MS);
+        }
+        break;
+    case ZMK_ACTIVITY_ACTIVE:
+        k_work_submit_to_queue(zmk_display_work_q(), &resume_work);
+        break;
+    default:
+        break;
+    }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(nice_view_park, park_listener);
+ZMK_SUBSCRIPTION(nice_view_park, zmk_activity_state_changed);
+
+void nice_view_park_init(lv_obj_t *screen) { park_screen = screen; }
+
+void nice_view_park_hook_register(struct nice_view_park_hook *hook) {
+    sys_slist_append(&hooks, &hook->node);
+}
+
+bool nice_view_is_parked(void) { return parked; }
@@ -0,0 +1,26 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+/*
+ * Called on the display work queue when the keyboard goes to sleep and when
+ * it wakes again. park() stops any timers of its own and may draw into the
+ * parked frame; resume() restarts them.
+ */
+struct nice_view_park_hook {
+    sys_snode_t node;
+    void (*park)(struct nice_view_park_hook *hook);
+    void (*resume)(struct nice_view_park_hook *hook);
+};
+
+void nice_view_park_init(lv_obj_t *screen);
+void nice_view_park_hook_register(struct nice_view_park_hook *hook);
+bool nice_view_is_parked(void);
@@ -7,6 +7,7 @@
  *  ───────────
  *  • Uses k_work_delayable instead of LVGL timers (better battery + ZMK‑compatible).
  *  • Randomized slideshow logic (Fisher-Yates, no repeats until full cycle).
+ *  • All drawing goes through the display scheduler (see scheduler.h).
  */
 
  #include <zephyr/kernel.h>
@@ -23,56 +24,29 @@
  #include <zmk/events/usb_conn_state_changed.h>
  #include <zmk/event_manager.h>
  #include <zmk/events/battery_state_changed.h>
+ #include <zmk/events/position_state_changed.h>
  #include <zmk/split/bluetooth/peripheral.h>
  #include <zmk/events/split_peripheral_status_changed.h>
  #include <zmk/usb.h>
  #include <zmk/ble.h>
  
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+ #include "event_ring.h"
+ #endif
+ #include "park.h"
  #include "peripheral_status.h"
+ #include "scheduler.h"
+ #include "slides.h"
+ #include "slideshow.h"
+ #include "sprite.h"
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+ #include "stabilise.h"
+ #endif
+ #include "watchdog.h"
  
- /* ───── Art assets ──────────────────────────────────────────────────────────────── */
- 
- LV_IMG_DECLARE(hammerbeam1);
- LV_IMG_DECLARE(hammerbeam2);
- LV_IMG_DECLARE(hammerbeam3);
- LV_IMG_DECLARE(hammerbeam4);
- LV_IMG_DECLARE(hammerbeam5);
- LV_IMG_DECLARE(hammerbeam6);
- LV_IMG_DECLARE(hammerbeam7);
- LV_IMG_DECLARE(hammerbeam8);
- LV_IMG_DECLARE(hammerbeam9);
- LV_IMG_DECLARE(hammerbeam10);
- LV_IMG_DECLARE(hammerbeam11);
- LV_IMG_DECLARE(hammerbeam12);
- LV_IMG_DECLARE(hammerbeam13);
- LV_IMG_DECLARE(hammerbeam14);
- LV_IMG_DECLARE(hammerbeam15);
- LV_IMG_DECLARE(hammerbeam16);
- LV_IMG_DECLARE(hammerbeam17);
- LV_IMG_DECLARE(hammerbeam18);
- LV_IMG_DECLARE(hammerbeam19);
- LV_IMG_DECLARE(hammerbeam20);
- LV_IMG_DECLARE(hammerbeam21);
- LV_IMG_DECLARE(hammerbeam22);
- LV_IMG_DECLARE(hammerbeam23);
- LV_IMG_DECLARE(hammerbeam24);
- LV_IMG_DECLARE(hammerbeam25);
- LV_IMG_DECLARE(hammerbeam26);
- LV_IMG_DECLARE(hammerbeam27);
- LV_IMG_DECLARE(hammerbeam28);
- LV_IMG_DECLARE(hammerbeam29);
- LV_IMG_DECLARE(hammerbeam30);
- 
- static const lv_img_dsc_t *anim_imgs[] = {
-     &hammerbeam1, &hammerbeam2, &hammerbeam3, &hammerbeam4, &hammerbeam5,
-     &hammerbeam6, &hammerbeam7, &hammerbeam8, &hammerbeam9, &hammerbeam10,
-     &hammerbeam11, &hammerbeam12, &hammerbeam13, &hammerbeam14, &hammerbeam15,
-     &hammerbeam16, &hammerbeam17, &hammerbeam18, &hammerbeam19, &hammerbeam20,
-     &hammerbeam21, &hammerbeam22, &hammerbeam23, &hammerbeam24, &hammerbeam25,
-     &hammerbeam26, &hammerbeam27, &hammerbeam28, &hammerbeam29, &hammerbeam30,
- };
+ /* ───── Art assets (see slides.c) ───────────────────────────────────────────────── */
  
- #define ART_FRAME_COUNT      (ARRAY_SIZE(anim_imgs))
+ #define ART_FRAME_COUNT      (slides_count())
  #define ART_ROTATE_INTERVAL  600000 /* 10 minutes */
  
  /* ───── ZMK widget bookkeeping ───────────────────────────────────────────────────── */
@@ -85,67 +59,260 @@
  
  /* ───── Slideshow logic (random order + delayed Zephyr workqueue) ──────────────── */
  
+ /*
+  * `show` is only touched on the display work queue. The timer and the key
+  * listener run elsewhere, so they post an advance request and invalidate the
+  * art; render_art() does the advance.
+  */
  static lv_obj_t *art_box;
- static uint8_t order[ART_FRAME_COUNT];
- static uint8_t order_pos;
+ static struct slideshow show;
  static struct k_work_delayable slideshow_work;
  
- static void shuffle_order(void) {
-     for (uint8_t i = 0; i < ART_FRAME_COUNT; i++) {
-         order[i] = i;
+ #define ADVANCE_BY_TIMER BIT(0)
+ #define ADVANCE_BY_KEY BIT(1)
+ static atomic_t advance_requests;
+ 
+ /* Low 32 bits of show.deadline, for the key listener to compare against */
+ static atomic_t deadline_ms;
+ 
+ /* Why the slideshow advanced, to compare the advance policies */
+ static uint32_t timer_wakes;
+ static uint32_t key_advances;
+ 
+ static void show_slide(size_t index) {
+     uint32_t start = render_watchdog_stage_begin();
+ 
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+     event_ring_record(EVENT_RING_SLIDE, index, NULL, 0);
+ #endif
+ #if IS_ENABLED(CONFIG_NICE_VIEW_ART_LS0XX)
+     const struct display_flush_overlay *rows = slides_get_rows(index);
+     if (rows != NULL) {
+         display_flush_set_overlay(rows);
+         lv_obj_invalidate(art_box);
+     }
+     render_watchdog_stage_end(RENDER_STAGE_DECODE, start);
+ #else
+     const lv_img_dsc_t *slide = slides_get(index);
+     if (slide == NULL) {
+         render_watchdog_stage_end(RENDER_STAGE_DECODE, start);
+         return;
+     }
+     lv_obj_clean(art_box);
+     lv_obj_t *img = lv_img_create(art_box);
+     lv_img_set_src(img, slide);
+     lv_obj_align(img, LV_ALIGN_TOP_LEFT, 0, 0);
+ #if IS_ENABLED(CONFIG_NICE_VIEW_ART_SPRITES)
+     sprites_attach(img, slide);
+ #endif
+     render_watchdog_stage_end(RENDER_STAGE_DECODE, start);
+ #endif
+ }
+ 
+ /* Display work queue; the only place that moves the slideshow forward */
+ static bool advance_show(uint32_t requests, int64_t now) {
+     if (requests & ADVANCE_BY_KEY) {
+         slideshow_restart(&show, now);
+         key_advances++;
+         LOG_DBG("Slide advance by key (%u timer wakes, %u key advances)", timer_wakes,
+                 key_advances);
+         return true;
      }
-     for (int i = ART_FRAME_COUNT - 1; i > 0; --i) {
-         uint32_t j = sys_rand32_get() % (i + 1);
-         uint8_t tmp = order[i];
-         order[i] = order[j];
-         order[j] = tmp;
+ 
+     if (requests & ADVANCE_BY_TIMER) {
+         timer_wakes++;
+         if (slideshow_advance_deadline(&show, now) > 0) {
+             LOG_DBG("Slide advance by timer (%u timer wakes, %u key advances)", timer_wakes,
+                     key_advances);
+             return true;
+         }
+         return false;
      }
-     order_pos = 0;
+ 
+     /* First render: show a slide without touching the schedule */
+     return true;
+ }
+ 
+ static void schedule_advance(void) {
+     atomic_set(&deadline_ms, (atomic_val_t)(uint32_t)show.deadline);
+ #if !IS_ENABLED(CONFIG_NICE_VIEW_ART_ADVANCE_KEYS)
+     k_work_schedule(&slideshow_work, K_TIMEOUT_ABS_MS(show.deadline));
+ #endif
  }
  
+ static void render_art(struct nice_view_widget *region) {
+     bool advance = advance_show(atomic_clear(&advance_requests), k_uptime_get());
+ 
+     schedule_advance();
+     if (advance) {
+         show_slide(slideshow_next(&show));
+     }
+ }
+ 
+ static struct nice_view_widget art_region = {
+     .name = "art",
+     .region = {.x1 = 0, .y1 = 0, .x2 = 139, .y2 = 67},
+     .inputs = NICE_VIEW_INPUT_TIMER,
+     .priority = UINT8_MAX,
+     .budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US,
+     .render = render_art,
+ };
+ 
+ /*
+  * Runs on the system work queue: only post the request. Deadlines are absolute,
+  * so however late the render runs the next one stays on the grid; render_art()
+  * schedules it.
+  */
  static void slideshow_work_cb(struct k_work *work) {
-     if (order_pos >= ART_FRAME_COUNT) {
-         shuffle_order();
+     atomic_or(&advance_requests, ADVANCE_BY_TIMER);
+     nice_view_widget_invalidate(&art_region);
+ }
+ 
+ /* ───── Key-driven advance (no timer wakeups of its own) ─────────────────────────── */
+ 
+ #if IS_ENABLED(CONFIG_NICE_VIEW_ART_ADVANCE_KEYS)
+ static uint32_t presses_since_advance;
+ 
+ /*
+  * Advance after CONFIG_NICE_VIEW_ART_ADVANCE_KEY_COUNT presses, or on the first
+  * press once the interval has passed. Either way the CPU is already awake for
+  * the key, so the slideshow never wakes it by itself.
+  */
+ static int slideshow_key_listener(const zmk_event_t *eh) {
+     const struct zmk_position_state_changed *ev = as_zmk_position_state_changed(eh);
+ 
+     if (ev == NULL || !ev->state) {
+         return ZMK_EV_EVENT_BUBBLE;
      }
  
-     lv_obj_clean(art_box);
-     lv_obj_t *img = lv_img_create(art_box);
-     lv_img_set_src(img, anim_imgs[order[order_pos++]]);
-     lv_obj_align(img, LV_ALIGN_TOP_LEFT, 0, 0);
+     bool by_count = CONFIG_NICE_VIEW_ART_ADVANCE_KEY_COUNT > 0 &&
+                     ++presses_since_advance >= CONFIG_NICE_VIEW_ART_ADVANCE_KEY_COUNT;
+     bool due = (int32_t)(k_uptime_get_32() - (uint32_t)atomic_get(&deadline_ms)) >= 0;
+ 
+     if (by_count || due) {
+         presses_since_advance = 0;
+         atomic_or(&advance_requests, ADVANCE_BY_KEY);
+         nice_view_widget_invalidate(&art_region);
+     }
  
-     k_work_schedule(&slideshow_work, K_MSEC(ART_ROTATE_INTERVAL));
+     return ZMK_EV_EVENT_BUBBLE;
  }
  
+ ZMK_LISTENER(nice_view_slideshow, slideshow_key_listener);
+ ZMK_SUBSCRIPTION(nice_view_slideshow, zmk_position_state_changed);
+ #endif
+ 
+ /* ───── Sleep parking (see park.c) ──────────────────────────────────────────────── */
+ 
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK)
+ /* No slide changes while asleep; optionally leave a chosen slide on the panel */
+ static void art_park(struct nice_view_park_hook *hook) {
+     k_work_cancel_delayable(&slideshow_work);
+     if (CONFIG_NICE_VIEW_ART_PARK_SLIDE > 0 && CONFIG_NICE_VIEW_ART_PARK_SLIDE <= ART_FRAME_COUNT) {
+         show_slide(CONFIG_NICE_VIEW_ART_PARK_SLIDE - 1);
+     }
+ }
+ 
+ /* Display work queue like render_art(), so `show` can be used directly */
+ static void art_resume(struct nice_view_park_hook *hook) {
+     /* Requests that raced with parking are dropped with the slides they would have shown */
+     atomic_clear(&advance_requests);
+ #if IS_ENABLED(CONFIG_NICE_VIEW_ART_ADVANCE_KEYS)
+     slideshow_restart(&show, k_uptime_get());
+ #else
+     /* Boundaries passed while parked are skipped, not caught up */
+     slideshow_advance_deadline(&show, k_uptime_get());
+ #endif
+     schedule_advance();
+ }
+ 
+ static struct nice_view_park_hook art_park_hook = {
+     .park = art_park,
+     .resume = art_resume,
+ };
+ #endif
+ 
  /* ───── Status bar (battery and Wi-Fi icons) ────────────────────────────────────── */
  
  static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
      lv_obj_t *canvas = lv_obj_get_child(widget, 0);
      lv_draw_label_dsc_t label_dsc;
      init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_16, LV_TEXT_ALIGN_RIGHT);
-     lv_draw_rect_dsc_t rect_black_dsc;
-     init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
  
-     lv_canvas_draw_rect(canvas, 0, 0, CANVAS_SIZE, CANVAS_SIZE, &rect_black_dsc);
+     draw_background(cbuf, background_battery);
      draw_battery(canvas, state);
      lv_canvas_draw_text(canvas, 0, 0, CANVAS_SIZE, &label_dsc,
                          state->connected ? LV_SYMBOL_WIFI : LV_SYMBOL_CLOSE);
      rotate_canvas(canvas, cbuf);
  }
  
+ static void render_top(struct nice_view_widget *region) {
+     struct zmk_widget_status *widget;
+     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+         draw_top(widget->obj, widget->cbuf, &widget->state);
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_CHARGING_ANIMATION)
+         charging_anim_update(&widget->charging);
+ #endif
+     }
+ }
+ 
+ static struct nice_view_widget top_region = {
+     .name = "top",
+     .region = {.x1 = 92, .y1 = 0, .x2 = 159, .y2 = 67},
+     .inputs = NICE_VIEW_INPUT_BATTERY | NICE_VIEW_INPUT_OUTPUT,
+     .priority = 0,
+     .budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US,
+     .render = render_top,
+ };
+ 
  /* ───── Battery state handling ───────────────────────────────────────────────────── */
  
- static void set_battery_status(struct zmk_widget_status *widget, struct battery_status_state state) {
+ /* Returns true when the charging flag changed */
+ static bool set_battery_status(struct zmk_widget_status *widget, struct battery_status_state state) {
+     bool changed = false;
  #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+     changed = widget->state.charging != state.usb_present;
      widget->state.charging = state.usb_present;
  #endif
+ #if !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
      widget->state.battery = state.level;
-     draw_top(widget->obj, widget->cbuf, &widget->state);
+ #endif
+     return changed;
+ }
+ 
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+ static void apply_battery_level(struct stabiliser *stabiliser) {
+     struct zmk_widget_status *widget;
+     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+         widget->state.battery = stabiliser->shown;
+     }
+     nice_view_widgets_notify(NICE_VIEW_INPUT_BATTERY);
  }
  
+ static struct stabiliser battery_level = {
+     .name = "battery",
+     .config = {
+         .quantum = CONFIG_NICE_VIEW_WIDGET_STABILISE_BATTERY_QUANTUM,
+         .hysteresis = CONFIG_NICE_VIEW_WIDGET_STABILISE_BATTERY_HYSTERESIS,
+         .hold_ms = CONFIG_NICE_VIEW_WIDGET_STABILISE_BATTERY_HOLD_MS,
+     },
+     .apply = apply_battery_level,
+ };
+ #endif
+ 
  static void battery_status_update_cb(struct battery_status_state state) {
      struct zmk_widget_status *widget;
+     bool changed = !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE);
+ 
      SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
-         set_battery_status(widget, state);
+         changed |= set_battery_status(widget, state);
+     }
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+     stabiliser_update(&battery_level, state.level);
+ #endif
+ 
+     if (changed) {
+         nice_view_widgets_notify(NICE_VIEW_INPUT_BATTERY);
      }
  }
  
@@ -173,15 +340,36 @@
  
  static void set_connection_status(struct zmk_widget_status *widget, struct peripheral_status_state state) {
      widget->state.connected = state.connected;
-     draw_top(widget->obj, widget->cbuf, &widget->state);
  }
  
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+ static void apply_connection(struct stabiliser *stabiliser) {
+     struct peripheral_status_state state = {.connected = stabiliser->shown};
+     struct zmk_widget_status *widget;
+     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+         set_connection_status(widget, state);
+     }
+     nice_view_widgets_notify(NICE_VIEW_INPUT_OUTPUT);
+ }
+ 
+ static struct stabiliser connection = {
+     .name = "connection",
+     .config = {.quantum = 1, .hold_ms = CONFIG_NICE_VIEW_WIDGET_STABILISE_CONNECTION_HOLD_MS},
+     .apply = apply_connection,
+ };
+ 
+ static void output_status_update_cb(struct peripheral_status_state state) {
+     stabiliser_update(&connection, state.connected);
+ }
+ #else
  static void output_status_update_cb(struct peripheral_status_state state) {
      struct zmk_widget_status *widget;
      SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
          set_connection_status(widget, state);
      }
+     nice_view_widgets_notify(NICE_VIEW_INPUT_OUTPUT);
  }
+ #endif
  
  ZMK_DISPLAY_WIDGET_LISTENER(widget_peripheral_status, struct peripheral_status_state,
                              output_status_update_cb, get_state)
@@ -196,18 +384,29 @@
      lv_obj_t *top = lv_canvas_create(widget->obj);
      lv_obj_align(top, LV_ALIGN_TOP_RIGHT, 0, 0);
      lv_canvas_set_buffer(top, widget->cbuf, CANVAS_SIZE, CANVAS_SIZE, LV_IMG_CF_TRUE_COLOR);
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_CHARGING_ANIMATION)
+     charging_anim_init(&widget->charging, top, widget->cbuf, &widget->state);
+ #endif
  
      art_box = lv_obj_create(widget->obj);
      lv_obj_clear_flag(art_box, LV_OBJ_FLAG_SCROLLABLE);
      lv_obj_set_size(art_box, 140, 68);
      lv_obj_align(art_box, LV_ALIGN_TOP_LEFT, 0, 0);
  
-     shuffle_order();
+     slides_init();
+     slideshow_init(&show, ART_FRAME_COUNT, ART_ROTATE_INTERVAL, k_uptime_get(), sys_rand32_get);
      k_work_init_delayable(&slideshow_work, slideshow_work_cb);
-     slideshow_work_cb(NULL);
-     k_work_schedule(&slideshow_work, K_MSEC(ART_ROTATE_INTERVAL));
+     schedule_advance();
  
      sys_slist_append(&widgets, &widget->node);
+     nice_view_widget_register(&top_region);
+     nice_view_widget_register(&art_region);
+ #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK)
+     nice_view_park_hook_register(&art_park_hook);
+ #endif
+ #if IS_ENABLED(CONFIG_NICE_VIEW_ART_SPRITES)
+     sprites_init();
+ #endif
      widget_battery_status_init();
      widget_peripheral_status_init();
  
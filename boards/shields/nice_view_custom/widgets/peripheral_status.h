@@ -10,11 +10,15 @@
 #include <lvgl.h>
 #include <zephyr/kernel.h>
 #include "util.h"
+#include "charging.h"
 
 struct zmk_widget_status {
     sys_snode_t node;
     lv_obj_t *obj;
     lv_color_t cbuf[CANVAS_SIZE * CANVAS_SIZE];
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_CHARGING_ANIMATION)
+    struct charging_anim charging;
+#endif
     struct status_state state;
 };
 
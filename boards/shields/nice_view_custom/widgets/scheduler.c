@@ -0,0 +1,258 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+#include "event_ring.h"
+#endif
+#include "scheduler.h"
+#include "watchdog.h"
+
+static const char *const class_names[NICE_VIEW_INPUT_CLASSES] = {
+    "layer", "output", "battery", "wpm", "timer",
+};
+
+static sys_slist_t registry = SYS_SLIST_STATIC_INIT(&registry);
+static struct nice_view_sched_latency latency[NICE_VIEW_INPUT_CLASSES];
+
+/* True while jobs are being rendered back to back, i.e. the same LVGL frame */
+static bool in_burst;
+
+static atomic_t suspended;
+
+/* Keeps a widget's pending bits and their pending_since times in step */
+static struct k_spinlock pending_lock;
+
+static void sched_work_cb(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(sched_work, sched_work_cb);
+
+static void record_latency(struct nice_view_widget *widget, uint32_t served, const uint32_t *since,
+                           uint32_t now) {
+    for (int i = 0; i < NICE_VIEW_INPUT_CLASSES; i++) {
+        if (!(served & BIT(i))) {
+            continue;
+        }
+
+        uint32_t us = k_cyc_to_us_floor32(now - since[i]);
+        latency[i].jobs++;
+        latency[i].total_us += us;
+        latency[i].max_us = MAX(latency[i].max_us, us);
+        LOG_DBG("Rendered %s for %s input after %u us", widget->name, class_names[i], us);
+    }
+}
+
+static void render_widget(struct nice_view_widget *widget, int64_t now) {
+    uint32_t since[NICE_VIEW_INPUT_CLASSES];
+    k_spinlock_key_t key = k_spin_lock(&pending_lock);
+
+    /* Take every pending input at once; anything notified from here on queues a new job */
+    uint32_t served = atomic_clear(&widget->pending);
+    memcpy(since, widget->pending_since, sizeof(since));
+    k_spin_unlock(&pending_lock, key);
+
+    render_watchdog_widget_begin(widget->name);
+
+    uint32_t start = k_cycle_get_32();
+    widget->render(widget);
+    uint32_t end = k_cycle_get_32();
+    widget->last_cost_us = k_cyc_to_us_floor32(end - start);
+    widget->last_render = now;
+
+    if (render_watchdog_widget_end(widget->last_cost_us, widget->budget_us)) {
+        widget->overruns++;
+        widget->hold_until = now + CONFIG_NICE_VIEW_WIDGET_SCHED_OVERRUN_HOLDOFF_MS;
+    }
+
+    record_latency(widget, served, since, end);
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+    event_ring_record(EVENT_RING_RENDER, served, &widget->region, widget->last_cost_us);
+#endif
+}
+
+/*
+ * Pick the ready widget whose most urgent pending input has the lowest class,
+ * breaking ties by widget priority (the registry is sorted by it).
+ */
+static struct nice_view_widget *next_job(int64_t now, int64_t *next) {
+    struct nice_view_widget *widget, *best = NULL;
+    int best_class = NICE_VIEW_INPUT_CLASSES;
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&registry, widget, node) {
+        uint32_t pending = atomic_get(&widget->pending);
+        if (pending == 0) {
+            continue;
+        }
+
+        int64_t ready = MAX(widget->last_render + widget->min_interval_ms, widget->hold_until);
+        if (ready > now) {
+            *next = MIN(*next, ready);
+            continue;
+        }
+
+        int input_class = find_lsb_set(pending) - 1;
+        if (input_class < best_class) {
+            best = widget;
+            best_class = input_class;
+        }
+    }
+
+    return best;
+}
+
+/*
+ * Renders one job per run and resubmits itself, so that listener callbacks and
+ * LVGL refreshes queued on the display work queue in the meantime get to run
+ * and newly raised higher-class work overtakes what is still pending.
+ */
+static void sched_work_cb(struct k_work *work) {
+    if (atomic_get(&suspended)) {
+        return;
+    }
+
+    int64_t now = k_uptime_get();
+    int64_t next = INT64_MAX;
+    struct nice_view_widget *widget = next_job(now, &next);
+
+    if (widget != NULL) {
+        if (!in_burst) {
+            render_watchdog_frame_begin();
+            in_burst = true;
+        }
+        render_widget(widget, now);
+        next = INT64_MAX;
+        widget = next_job(now, &next);
+    }
+
+    if (widget != NULL) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), &sched_work, K_NO_WAIT);
+        return;
+    }
+
+    if (in_burst) {
+        render_watchdog_frame_end();
+        in_burst = false;
+    }
+
+    if (next != INT64_MAX) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), &sched_work, K_MSEC(next - now));
+    }
+}
+
+static void mark_pending(struct nice_view_widget *widget, uint32_t inputs) {
+    uint32_t now = k_cycle_get_32();
+    k_spinlock_key_t key = k_spin_lock(&pending_lock);
+
+    for (int i = 0; i < NICE_VIEW_INPUT_CLASSES; i++) {
+        /* Work already queued for this class is superseded, but its wait keeps counting */
+        if ((inputs & BIT(i)) && !atomic_test_and_set_bit(&widget->pending, i)) {
+            widget->pending_since[i] = now;
+        }
+    }
+
+    k_spin_unlock(&pending_lock, key);
+}
+
+int nice_view_widget_register(struct nice_view_widget *widget) {
+    struct nice_view_widget *prev = NULL, *iter;
+
+    if (widget->render == NULL) {
+        return -EINVAL;
+    }
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&registry, iter, node) {
+        if (iter == widget) {
+            return -EALREADY;
+        }
+        if (iter->priority <= widget->priority) {
+            prev = iter;
+        }
+    }
+
+    if (prev == NULL) {
+        sys_slist_prepend(&registry, &widget->node);
+    } else {
+        sys_slist_insert(&registry, &prev->node, &widget->node);
+    }
+
+    nice_view_widget_invalidate(widget);
+    return 0;
+}
+
+static void kick(void) {
+    if (!atomic_get(&suspended)) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), &sched_work, K_NO_WAIT);
+    }
+}
+
+void nice_view_widget_invalidate(struct nice_view_widget *widget) {
+    mark_pending(widget, NICE_VIEW_INPUT_TIMER);
+    kick();
+}
+
+void nice_view_widgets_notify(uint32_t inputs) {
+    struct nice_view_widget *widget;
+    bool any = false;
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&registry, widget, node) {
+        if (widget->inputs & inputs) {
+            mark_pending(widget, widget->inputs & inputs);
+            any = true;
+        }
+    }
+
+    if (any) {
+        kick();
+    }
+}
+
+void nice_view_sched_suspend(void) {
+    atomic_set(&suspended, true);
+    k_work_cancel_delayable(&sched_work);
+
+    /* A burst cut short here is over; the next one after resume starts its own frame */
+    if (in_burst) {
+        render_watchdog_frame_end();
+        in_burst = false;
+    }
+}
+
+void nice_view_sched_resume(void) {
+    atomic_set(&suspended, false);
+    kick();
+}
+
+void nice_view_sched_get_latency(int input_class, struct nice_view_sched_latency *out) {
+    if (input_class >= 0 && input_class < NICE_VIEW_INPUT_CLASSES) {
+        *out = latency[input_class];
+    }
+}
+
+#if IS_ENABLED(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+static int cmd_latency(const struct shell *sh, size_t argc, char **argv) {
+    struct nice_view_sched_latency stats;
+
+    shell_print(sh, "%-8s %8s %10s %10s", "input", "jobs", "avg us", "max us");
+    for (int i = 0; i < NICE_VIEW_INPUT_CLASSES; i++) {
+        nice_view_sched_get_latency(i, &stats);
+        shell_print(sh, "%-8s %8u %10u %10u", class_names[i], stats.jobs,
+                    stats.jobs > 0 ? (uint32_t)(stats.total_us / stats.jobs) : 0, stats.max_us);
+    }
+
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((nice_view), latency, NULL, "Wait from notification to render per input class",
+                 cmd_latency, 1, 0);
+#endif
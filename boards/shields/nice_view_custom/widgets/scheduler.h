@@ -0,0 +1,74 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+/*
+ * Inputs a widget can subscribe to; see nice_view_widgets_notify(). The bit
+ * number is also the input's priority class: pending work for a lower bit is
+ * rendered first. TIMER covers the art and widget-driven animation.
+ */
+#define NICE_VIEW_INPUT_LAYER BIT(0)
+#define NICE_VIEW_INPUT_OUTPUT BIT(1)
+#define NICE_VIEW_INPUT_BATTERY BIT(2)
+#define NICE_VIEW_INPUT_WPM BIT(3)
+#define NICE_VIEW_INPUT_TIMER BIT(4)
+#define NICE_VIEW_INPUT_CLASSES 5
+
+/*
+ * A region of the screen owned by one widget. The widget fills in the
+ * declaration part and registers it once; the display scheduler then decides
+ * when `render` runs. Rendering always happens on the display work queue.
+ */
+struct nice_view_widget {
+    const char *name;
+    /* Screen area the widget draws into */
+    lv_area_t region;
+    /* NICE_VIEW_INPUT_* mask the widget redraws on */
+    uint32_t inputs;
+    /* Orders widgets with pending work of the same input class, lower first */
+    uint8_t priority;
+    /* Minimum time between two renders, 0 for no limit */
+    uint16_t min_interval_ms;
+    /* Render cost budget; overrunning it defers the widget's next render */
+    uint32_t budget_us;
+    void (*render)(struct nice_view_widget *widget);
+
+    /* Scheduler bookkeeping, zero-initialise */
+    sys_snode_t node;
+    /* NICE_VIEW_INPUT_* mask of pending work; one render serves all of it */
+    atomic_t pending;
+    uint32_t pending_since[NICE_VIEW_INPUT_CLASSES];
+    int64_t last_render;
+    int64_t hold_until;
+    uint32_t last_cost_us;
+    uint32_t overruns;
+};
+
+/* Time from the first notification of an input class to the render that served it */
+struct nice_view_sched_latency {
+    uint32_t jobs;
+    uint32_t max_us;
+    uint64_t total_us;
+};
+
+int nice_view_widget_register(struct nice_view_widget *widget);
+/* Queue a render of one widget in the TIMER class, e.g. the next animation step */
+void nice_view_widget_invalidate(struct nice_view_widget *widget);
+void nice_view_widgets_notify(uint32_t inputs);
+void nice_view_sched_get_latency(int input_class, struct nice_view_sched_latency *latency);
+
+/*
+ * Stop rendering altogether: invalidations are still recorded but nothing is
+ * queued, so no widget can wake the CPU. Resuming renders whatever piled up.
+ * Display work queue only.
+ */
+void nice_view_sched_suspend(void);
+void nice_view_sched_resume(void);
@@ -0,0 +1,80 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#include "scratch.h"
+
+#define SCRATCH_USERS 8
+
+static uint8_t arena[SCRATCH_SIZE] __aligned(sizeof(uint32_t));
+static size_t top;
+static size_t high_water;
+
+/* Largest request per user: the static buffers the arena stands in for */
+static struct {
+    const char *name;
+    size_t size;
+} users[SCRATCH_USERS];
+
+static void report(const char *user, size_t size) {
+    size_t standalone = 0;
+    int i;
+
+    for (i = 0; i < SCRATCH_USERS && users[i].name != NULL; i++) {
+        if (users[i].name == user) {
+            break;
+        }
+    }
+
+    if (i == SCRATCH_USERS || size <= users[i].size) {
+        return;
+    }
+
+    users[i].name = user;
+    users[i].size = size;
+
+    for (i = 0; i < SCRATCH_USERS && users[i].name != NULL; i++) {
+        standalone += users[i].size;
+    }
+
+    /* Only logs when a stage first needs more, i.e. a handful of times after boot */
+    LOG_INF("Scratch arena %d bytes, high water %zu: %s takes %zu, separate buffers would take "
+            "%zu (%d reclaimed)",
+            SCRATCH_SIZE, high_water, user, size, standalone, (int)standalone - SCRATCH_SIZE);
+}
+
+size_t scratch_mark(void) { return top; }
+
+void scratch_release(size_t mark) {
+    __ASSERT(mark <= top, "Scratch released out of order");
+    top = mark;
+}
+
+void *scratch_alloc(const char *user, size_t size) {
+    size_t start = ROUND_UP(top, sizeof(uint32_t));
+
+    __ASSERT(k_current_get() == k_work_queue_thread_get(zmk_display_work_q()),
+             "Scratch used off the display work queue");
+
+    if (start + size > sizeof(arena)) {
+        LOG_ERR("Scratch arena too small: %s needs %zu bytes at %zu of %d", user, size, start,
+                SCRATCH_SIZE);
+        return NULL;
+    }
+
+    top = start + size;
+    high_water = MAX(high_water, top);
+    report(user, size);
+
+    return &arena[start];
+}
@@ -0,0 +1,36 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/*
+ * One scratch region shared by the render stages that need a temporary buffer
+ * (canvas rotation, art decoding, benchmarks) instead of each keeping its own
+ * static one. Only used from the display work queue, where those stages never
+ * overlap, so allocation is a stack: take a mark, allocate, release the mark.
+ *
+ *     size_t mark = scratch_mark();
+ *     uint8_t *tmp = scratch_alloc("rotate", size);
+ *     ...
+ *     scratch_release(mark);
+ */
+#define SCRATCH_SIZE CONFIG_NICE_VIEW_WIDGET_SCRATCH_SIZE
+
+/*
+ * Every user states its largest allocation next to the call, so an arena
+ * configured too small fails the build rather than the render.
+ */
+#define SCRATCH_RESERVE(user, size)                                                                \
+    BUILD_ASSERT((size) <= SCRATCH_SIZE,                                                           \
+                 "CONFIG_NICE_VIEW_WIDGET_SCRATCH_SIZE too small for " user)
+
+size_t scratch_mark(void);
+void scratch_release(size_t mark);
+/* Word-aligned and uninitialised; NULL when the arena is too small */
+void *scratch_alloc(const char *user, size_t size);
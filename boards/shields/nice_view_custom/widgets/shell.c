@@ -0,0 +1,14 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+/* `nice_view` root command; each module adds its own subcommands with SHELL_SUBCMD_ADD() */
+SHELL_SUBCMD_SET_CREATE(sub_nice_view, (nice_view));
+
+SHELL_CMD_REGISTER(nice_view, &sub_nice_view, "nice!view display", NULL);
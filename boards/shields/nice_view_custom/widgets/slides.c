@@ -0,0 +1,255 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "scratch.h"
+#include "slides.h"
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_ART_INDEXED)
+LV_IMG_DECLARE(hammerbeam1);
+LV_IMG_DECLARE(hammerbeam2);
+LV_IMG_DECLARE(hammerbeam3);
+LV_IMG_DECLARE(hammerbeam4);
+LV_IMG_DECLARE(hammerbeam5);
+LV_IMG_DECLARE(hammerbeam6);
+LV_IMG_DECLARE(hammerbeam7);
+LV_IMG_DECLARE(hammerbeam8);
+LV_IMG_DECLARE(hammerbeam9);
+LV_IMG_DECLARE(hammerbeam10);
+LV_IMG_DECLARE(hammerbeam11);
+LV_IMG_DECLARE(hammerbeam12);
+LV_IMG_DECLARE(hammerbeam13);
+LV_IMG_DECLARE(hammerbeam14);
+LV_IMG_DECLARE(hammerbeam15);
+LV_IMG_DECLARE(hammerbeam16);
+LV_IMG_DECLARE(hammerbeam17);
+LV_IMG_DECLARE(hammerbeam18);
+LV_IMG_DECLARE(hammerbeam19);
+LV_IMG_DECLARE(hammerbeam20);
+LV_IMG_DECLARE(hammerbeam21);
+LV_IMG_DECLARE(hammerbeam22);
+LV_IMG_DECLARE(hammerbeam23);
+LV_IMG_DECLARE(hammerbeam24);
+LV_IMG_DECLARE(hammerbeam25);
+LV_IMG_DECLARE(hammerbeam26);
+LV_IMG_DECLARE(hammerbeam27);
+LV_IMG_DECLARE(hammerbeam28);
+LV_IMG_DECLARE(hammerbeam29);
+LV_IMG_DECLARE(hammerbeam30);
+
+static const lv_img_dsc_t *anim_imgs[] = {
+    &hammerbeam1,  &hammerbeam2,  &hammerbeam3,  &hammerbeam4,  &hammerbeam5,  &hammerbeam6,
+    &hammerbeam7,  &hammerbeam8,  &hammerbeam9,  &hammerbeam10, &hammerbeam11, &hammerbeam12,
+    &hammerbeam13, &hammerbeam14, &hammerbeam15, &hammerbeam16, &hammerbeam17, &hammerbeam18,
+    &hammerbeam19, &hammerbeam20, &hammerbeam21, &hammerbeam22, &hammerbeam23, &hammerbeam24,
+    &hammerbeam25, &hammerbeam26, &hammerbeam27, &hammerbeam28, &hammerbeam29, &hammerbeam30,
+};
+
+#endif
+
+/* Sprites draw into the slide, so built-in art is copied to RAM when they are enabled */
+#if IS_ENABLED(CONFIG_NICE_VIEW_ART_GRAY4) || IS_ENABLED(CONFIG_NICE_VIEW_ART_CM) ||             \
+    IS_ENABLED(CONFIG_NICE_VIEW_ART_SPRITES)
+
+#define SLIDE_STRIDE DIV_ROUND_UP(SLIDE_WIDTH, 8)
+#define SLIDE_PALETTE_SIZE 8
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_ART_GRAY4)
+
+#include "dither.h"
+
+/* Generated from the PGM images by scripts/gray_art.py */
+extern const struct gray_art gray_arts[];
+extern const size_t gray_art_count;
+
+#define SLIDE_SOURCE_COUNT gray_art_count
+
+static int decode_slide(size_t index, uint8_t *dst) {
+    const struct gray_art *art = &gray_arts[index];
+
+    if (art->width != SLIDE_WIDTH || art->height != SLIDE_HEIGHT) {
+        return -EINVAL;
+    }
+
+    return dither_art(art, dst, SLIDE_STRIDE);
+}
+
+#elif IS_ENABLED(CONFIG_NICE_VIEW_ART_CM)
+
+#include "art_cm.h"
+
+/* Generated from art.c by scripts/art_cm.py */
+extern const struct art_cm_slide art_cm_slides[];
+extern const size_t art_cm_count;
+
+#define SLIDE_SOURCE_COUNT art_cm_count
+
+static int decode_slide(size_t index, uint8_t *dst) {
+    const struct art_cm_slide *slide = &art_cm_slides[index];
+
+    if (slide->width != SLIDE_WIDTH || slide->height != SLIDE_HEIGHT) {
+        return -EINVAL;
+    }
+
+    return art_cm_decode(slide, dst, SLIDE_STRIDE);
+}
+
+#else
+
+#define SLIDE_SOURCE_COUNT ARRAY_SIZE(anim_imgs)
+
+static int decode_slide(size_t index, uint8_t *dst) {
+    const lv_img_dsc_t *img = anim_imgs[index];
+
+    if (img->header.w != SLIDE_WIDTH || img->header.h != SLIDE_HEIGHT ||
+        img->data_size != SLIDE_PALETTE_SIZE + SLIDE_STRIDE * SLIDE_HEIGHT) {
+        return -EINVAL;
+    }
+
+    memcpy(dst, &img->data[SLIDE_PALETTE_SIZE], SLIDE_STRIDE * SLIDE_HEIGHT);
+    return 0;
+}
+
+#endif
+
+static uint8_t frame_map[SLIDE_PALETTE_SIZE + SLIDE_STRIDE * SLIDE_HEIGHT] = {
+    0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
+    0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
+};
+
+static lv_img_dsc_t frame = {
+    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = SLIDE_WIDTH,
+    .header.h = SLIDE_HEIGHT,
+    .data_size = sizeof(frame_map),
+    .data = frame_map,
+};
+
+static int timed_decode(size_t index, uint32_t *us) {
+    uint32_t start = k_cycle_get_32();
+    int err = decode_slide(index, &frame_map[SLIDE_PALETTE_SIZE]);
+
+    *us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+    return err;
+}
+
+void slides_init(void) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_ART_BENCHMARK)
+    uint32_t worst = 0, total = 0;
+
+    for (size_t i = 0; i < SLIDE_SOURCE_COUNT; i++) {
+        uint32_t us;
+        if (timed_decode(i, &us) == 0) {
+            worst = MAX(worst, us);
+            total += us;
+        }
+    }
+
+    if (SLIDE_SOURCE_COUNT > 0) {
+        LOG_INF("Slide art: %zu slides, decode avg %u us, worst %u us (budget %u us)",
+                SLIDE_SOURCE_COUNT, total / SLIDE_SOURCE_COUNT, worst,
+                CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US);
+    }
+#endif
+}
+
+size_t slides_count(void) { return MIN(SLIDE_SOURCE_COUNT, CONFIG_NICE_VIEW_ART_MAX_SLIDES); }
+
+const lv_img_dsc_t *slides_get(size_t index) {
+    uint32_t us;
+
+    if (index >= slides_count()) {
+        return NULL;
+    }
+
+    int err = timed_decode(index, &us);
+    if (err) {
+        LOG_ERR("Failed to decode slide %zu (%d)", index, err);
+        return NULL;
+    }
+    LOG_DBG("Slide %zu decoded in %u us", index, us);
+
+    /* Same source, new pixels: drop anything LVGL cached for the previous slide */
+    lv_img_cache_invalidate_src(&frame);
+
+    return &frame;
+}
+
+#elif IS_ENABLED(CONFIG_NICE_VIEW_ART_LS0XX)
+
+#define SLIDE_STRIDE DIV_ROUND_UP(SLIDE_WIDTH, 8)
+
+/* Generated from art.c by scripts/art_ls0xx.py */
+extern const uint8_t art_ls0xx_rows[][SLIDE_HEIGHT][SLIDE_STRIDE];
+extern const size_t art_ls0xx_count;
+
+static struct display_flush_overlay rows = {
+    .width = SLIDE_WIDTH,
+    .height = SLIDE_HEIGHT,
+    .stride = SLIDE_STRIDE,
+};
+
+void slides_init(void) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_ART_BENCHMARK)
+    /* A flush copies the rows into a full-width panel buffer; time that for every slide */
+    const size_t row_bytes = DIV_ROUND_UP(160, 8);
+    SCRATCH_RESERVE("benchmark", SLIDE_HEIGHT * DIV_ROUND_UP(160, 8));
+    size_t mark = scratch_mark();
+    uint8_t *panel_rows = scratch_alloc("benchmark", SLIDE_HEIGHT * row_bytes);
+    uint32_t worst = 0, total = 0;
+
+    for (size_t i = 0; panel_rows != NULL && i < art_ls0xx_count; i++) {
+        uint32_t start = k_cycle_get_32();
+        rows.rows = &art_ls0xx_rows[i][0][0];
+        display_flush_overlay_apply(&rows, panel_rows, row_bytes, 0, SLIDE_HEIGHT - 1);
+        uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+        worst = MAX(worst, us);
+        total += us;
+    }
+    scratch_release(mark);
+
+    if (art_ls0xx_count > 0) {
+        LOG_INF("Slide art: %zu pre-packed slides, %zu bytes each in flash, no RAM frame, "
+                "row copy avg %u us, worst %u us",
+                art_ls0xx_count, sizeof(art_ls0xx_rows[0]), total / art_ls0xx_count, worst);
+    }
+#endif
+}
+
+size_t slides_count(void) { return MIN(art_ls0xx_count, CONFIG_NICE_VIEW_ART_MAX_SLIDES); }
+
+/* Nothing for LVGL to draw: the flush stage copies the rows in */
+const lv_img_dsc_t *slides_get(size_t index) { return NULL; }
+
+const struct display_flush_overlay *slides_get_rows(size_t index) {
+    if (index >= slides_count()) {
+        return NULL;
+    }
+
+    rows.rows = &art_ls0xx_rows[index][0][0];
+    return &rows;
+}
+
+#else
+
+void slides_init(void) {}
+
+size_t slides_count(void) { return MIN(ARRAY_SIZE(anim_imgs), CONFIG_NICE_VIEW_ART_MAX_SLIDES); }
+
+const lv_img_dsc_t *slides_get(size_t index) {
+    return index < slides_count() ? anim_imgs[index] : NULL;
+}
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+#define SLIDE_WIDTH 140
+#define SLIDE_HEIGHT 68
+
+void slides_init(void);
+size_t slides_count(void);
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_ART_LS0XX)
+#include "flush.h"
+
+/* Slide `index` as pre-packed panel rows for display_flush_set_overlay() */
+const struct display_flush_overlay *slides_get_rows(size_t index);
+#endif
+
+/*
+ * Image for slide `index`. With grayscale or compressed art, or with sprites,
+ * the slide is decoded into a shared RAM frame, so the returned image is only
+ * valid until the next call.
+ */
+const lv_img_dsc_t *slides_get(size_t index);
@@ -0,0 +1,69 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "slideshow.h"
+
+static void swap(uint8_t *a, uint8_t *b) {
+    uint8_t tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/* Fisher-Yates */
+static void shuffle(struct slideshow *show) {
+    for (uint8_t i = 0; i < show->count; i++) {
+        show->order[i] = i;
+    }
+    for (int i = (int)show->count - 1; i > 0; --i) {
+        swap(&show->order[i], &show->order[show->rand32() % (i + 1)]);
+    }
+
+    /* Keep the cycle boundary from showing the same slide twice in a row */
+    if (show->count > 1 && show->order[0] == show->last) {
+        swap(&show->order[0], &show->order[1 + show->rand32() % (show->count - 1)]);
+    }
+
+    show->pos = 0;
+}
+
+void slideshow_init(struct slideshow *show, size_t count, uint32_t interval_ms, int64_t now,
+                    uint32_t (*rand32)(void)) {
+    show->rand32 = rand32;
+    show->interval_ms = interval_ms;
+    show->count = count < SLIDESHOW_MAX_SLIDES ? count : SLIDESHOW_MAX_SLIDES;
+    show->last = SLIDESHOW_MAX_SLIDES;
+    show->deadline = now + interval_ms;
+    shuffle(show);
+}
+
+uint8_t slideshow_next(struct slideshow *show) {
+    if (show->count == 0) {
+        return 0;
+    }
+
+    if (show->pos >= show->count) {
+        shuffle(show);
+    }
+
+    show->last = show->order[show->pos++];
+    return show->last;
+}
+
+uint32_t slideshow_advance_deadline(struct slideshow *show, int64_t now) {
+    if (now < show->deadline) {
+        return 0;
+    }
+
+    uint32_t passed = (now - show->deadline) / show->interval_ms + 1;
+    show->deadline += (int64_t)passed * show->interval_ms;
+
+    return passed;
+}
+
+void slideshow_restart(struct slideshow *show, int64_t now) {
+    show->deadline = now + show->interval_ms;
+}
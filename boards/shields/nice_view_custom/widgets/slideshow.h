@@ -0,0 +1,55 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Slide order and advance deadlines of the peripheral slideshow, kept free of
+ * Zephyr, LVGL and ZMK so the same code can be driven by a virtual clock and a
+ * seeded random source on the host. Times are in ms on any monotonic clock.
+ */
+#define SLIDESHOW_MAX_SLIDES CONFIG_NICE_VIEW_ART_MAX_SLIDES
+
+struct slideshow {
+    uint32_t (*rand32)(void);
+    uint32_t interval_ms;
+    /* Absolute time of the next advance */
+    int64_t deadline;
+    uint8_t count;
+    uint8_t pos;
+    /* Slide shown last, SLIDESHOW_MAX_SLIDES before the first */
+    uint8_t last;
+    uint8_t order[SLIDESHOW_MAX_SLIDES];
+};
+
+void slideshow_init(struct slideshow *show, size_t count, uint32_t interval_ms, int64_t now,
+                    uint32_t (*rand32)(void));
+
+/*
+ * Next slide to show. Every slide is shown once per cycle in random order, and
+ * a new cycle never starts with the slide that ended the previous one.
+ */
+uint8_t slideshow_next(struct slideshow *show);
+
+/*
+ * Move the deadline to the first interval boundary after `now`, counted from
+ * the previous deadline rather than from when the caller woke up, so late
+ * wakes do not add up over months. Intervals missed entirely are skipped, not
+ * caught up. Returns how many boundaries were passed.
+ */
+uint32_t slideshow_advance_deadline(struct slideshow *show, int64_t now);
+
+/* Start a fresh interval at `now`, e.g. after a key-driven advance */
+void slideshow_restart(struct slideshow *show, int64_t now);
+
+static inline bool slideshow_due(const struct slideshow *show, int64_t now) {
+    return now >= show->deadline;
+}
@@ -0,0 +1,201 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "sprite.h"
+#include "scheduler.h"
+
+/* Palette of an LV_IMG_CF_INDEXED_1BIT image, ahead of the pixels */
+#define INDEXED_1BIT_PALETTE_SIZE 8
+
+/* A mascot walking along the bottom of the art, two frames */
+static const uint8_t walker_ink[] = {
+    0x3c, 0x42, 0xa5, 0x81, 0x81, 0x42, 0x5a, 0x55, /* frame 0 */
+    0x3c, 0x42, 0xa5, 0x81, 0x81, 0x42, 0xb6, 0xaa, /* frame 1 */
+};
+
+static const uint8_t walker_mask[] = {
+    0x3c, 0x7e, 0xff, 0xff, 0xff, 0x7e, 0x7e, 0x77, /* frame 0 */
+    0x3c, 0x7e, 0xff, 0xff, 0xff, 0x7e, 0xfe, 0xee, /* frame 1 */
+};
+
+static void walker_step(struct sprite *sprite, uint16_t width, uint16_t height) {
+    sprite->frame = (sprite->frame + 1) % sprite->frame_count;
+    sprite->x = sprite->x + 2 > width - SPRITE_WIDTH ? 0 : sprite->x + 2;
+    sprite->y = height - sprite->height - 1;
+}
+
+static struct sprite walker = {
+    .height = 8,
+    .frame_count = 2,
+    .ink = walker_ink,
+    .mask = walker_mask,
+    .step = walker_step,
+};
+
+static struct sprite *const sprites[] = {&walker};
+
+static struct {
+    lv_obj_t *img;
+    const lv_img_dsc_t *dsc;
+    uint8_t *pixels;
+    uint16_t stride;
+    uint16_t width;
+    uint16_t height;
+    int64_t started;
+} layer;
+
+/* Bytes of row `y` under a sprite at `x`; the second one is absent at the right edge */
+static uint16_t get_span(int x, int y) {
+    const uint8_t *row = &layer.pixels[y * layer.stride + x / 8];
+
+    return (row[0] << 8) | (x / 8 + 1 < layer.stride ? row[1] : 0);
+}
+
+static void put_span(int x, int y, uint16_t span) {
+    uint8_t *row = &layer.pixels[y * layer.stride + x / 8];
+
+    row[0] = span >> 8;
+    if (x / 8 + 1 < layer.stride) {
+        row[1] = span & 0xFF;
+    }
+}
+
+static void restore(struct sprite *sprite) {
+    for (int i = 0; i < sprite->height; i++) {
+        int y = sprite->drawn_y + i;
+        if (y >= 0 && y < layer.height) {
+            put_span(sprite->drawn_x, y, sprite->under[i]);
+        }
+    }
+    sprite->drawn = false;
+}
+
+static void draw(struct sprite *sprite) {
+    const uint8_t *ink = &sprite->ink[sprite->frame * sprite->height];
+    const uint8_t *mask = &sprite->mask[sprite->frame * sprite->height];
+    int shift = 8 - sprite->x % 8;
+
+    for (int i = 0; i < sprite->height; i++) {
+        int y = sprite->y + i;
+        if (y < 0 || y >= layer.height) {
+            continue;
+        }
+
+        uint16_t span = get_span(sprite->x, y);
+        uint16_t m = mask[i] << shift;
+
+        sprite->under[i] = span;
+        put_span(sprite->x, y, (span & ~m) | ((ink[i] << shift) & m));
+    }
+
+    sprite->drawn = true;
+    sprite->drawn_x = sprite->x;
+    sprite->drawn_y = sprite->y;
+}
+
+static void add_area(lv_area_t *dirty, bool *any, const struct sprite *sprite, int x, int y) {
+    lv_area_t area = {
+        .x1 = x, .y1 = y, .x2 = x + SPRITE_WIDTH - 1, .y2 = y + sprite->height - 1};
+
+    if (*any) {
+        _lv_area_join(dirty, dirty, &area);
+    } else {
+        *dirty = area;
+        *any = true;
+    }
+}
+
+/*
+ * Only the sprites' old and new rectangles are invalidated, so LVGL redraws and
+ * flushes just the rows they cover.
+ */
+static void invalidate(const lv_area_t *dirty) {
+    lv_area_t coords, area = *dirty;
+
+    lv_obj_get_coords(layer.img, &coords);
+    lv_area_move(&area, coords.x1, coords.y1);
+    lv_img_cache_invalidate_src(layer.dsc);
+    lv_obj_invalidate_area(layer.img, &area);
+}
+
+static void render_sprites(struct nice_view_widget *widget) {
+    bool expired = CONFIG_NICE_VIEW_ART_SPRITE_LIFETIME_S > 0 &&
+                   k_uptime_get() - layer.started >= CONFIG_NICE_VIEW_ART_SPRITE_LIFETIME_S * 1000;
+    lv_area_t dirty;
+    bool any = false;
+
+    if (layer.img == NULL) {
+        return;
+    }
+
+    /* Restore in reverse so overlapping sprites give back the art underneath */
+    for (int i = ARRAY_SIZE(sprites) - 1; i >= 0; i--) {
+        if (sprites[i]->drawn) {
+            add_area(&dirty, &any, sprites[i], sprites[i]->drawn_x, sprites[i]->drawn_y);
+            restore(sprites[i]);
+        }
+    }
+
+    if (!expired) {
+        for (int i = 0; i < ARRAY_SIZE(sprites); i++) {
+            sprites[i]->step(sprites[i], layer.width, layer.height);
+            draw(sprites[i]);
+            add_area(&dirty, &any, sprites[i], sprites[i]->x, sprites[i]->y);
+        }
+    }
+
+    if (any) {
+        invalidate(&dirty);
+    }
+
+    /* Self-scheduling; min_interval_ms caps the frame rate */
+    if (!expired) {
+        nice_view_widget_invalidate(widget);
+    }
+}
+
+static struct nice_view_widget sprites_region = {
+    .name = "sprites",
+    .region = {.x1 = 0, .y1 = 0, .x2 = 139, .y2 = 67},
+    .inputs = NICE_VIEW_INPUT_TIMER,
+    .priority = UINT8_MAX - 1,
+    .min_interval_ms = 1000 / CONFIG_NICE_VIEW_ART_SPRITE_FPS,
+    .budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US,
+    .render = render_sprites,
+};
+
+void sprites_attach(lv_obj_t *img, const lv_img_dsc_t *dsc) {
+    if (dsc == NULL || dsc->header.cf != LV_IMG_CF_INDEXED_1BIT) {
+        layer.img = NULL;
+        return;
+    }
+
+    layer.img = img;
+    layer.dsc = dsc;
+    layer.pixels = (uint8_t *)dsc->data + INDEXED_1BIT_PALETTE_SIZE;
+    layer.stride = DIV_ROUND_UP(dsc->header.w, 8);
+    layer.width = dsc->header.w;
+    layer.height = dsc->header.h;
+    layer.started = k_uptime_get();
+    lv_obj_update_layout(img);
+
+    /* The frame holds a fresh slide, so nothing drawn on the old one needs restoring */
+    for (int i = 0; i < ARRAY_SIZE(sprites); i++) {
+        sprites[i]->drawn = false;
+        sprites[i]->step(sprites[i], layer.width, layer.height);
+        draw(sprites[i]);
+    }
+
+    nice_view_widget_invalidate(&sprites_region);
+}
+
+void sprites_init(void) { nice_view_widget_register(&sprites_region); }
@@ -0,0 +1,49 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+#define SPRITE_WIDTH 8
+#define SPRITE_MAX_HEIGHT 16
+
+/*
+ * A small animated image drawn straight into the art frame. Before it is
+ * drawn, the pixels it covers are saved, so moving it only restores those and
+ * draws the new position; the art itself is never decoded or copied again.
+ */
+struct sprite {
+    /* Declaration, 8 pixels wide: one byte per row, MSB first */
+    uint8_t height;
+    uint8_t frame_count;
+    /* frame_count * height rows; 1 for white */
+    const uint8_t *ink;
+    /* Same layout; 1 where the sprite is opaque */
+    const uint8_t *mask;
+    /* Moves the sprite on by one tick: position and frame */
+    void (*step)(struct sprite *sprite, uint16_t width, uint16_t height);
+
+    int16_t x;
+    int16_t y;
+    uint8_t frame;
+
+    /* Save-under bookkeeping, zero-initialise */
+    bool drawn;
+    int16_t drawn_x;
+    int16_t drawn_y;
+    uint16_t under[SPRITE_MAX_HEIGHT];
+};
+
+void sprites_init(void);
+
+/*
+ * Display work queue only. `img` now shows `dsc`, a 1-bit indexed image in
+ * RAM that the sprites may draw into. Restarts the sprites' lifetime.
+ */
+void sprites_attach(lv_obj_t *img, const lv_img_dsc_t *dsc);
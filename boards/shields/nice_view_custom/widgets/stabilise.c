@@ -0,0 +1,149 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK)
+#include "park.h"
+#endif
+#include "stabilise.h"
+
+static sys_slist_t stabilisers = SYS_SLIST_STATIC_INIT(&stabilisers);
+
+static void recheck_work_cb(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(recheck_work, recheck_work_cb);
+
+static int32_t quantise(const struct stabiliser *s, int32_t value) {
+    uint16_t quantum = MAX(s->config.quantum, 1);
+
+    return MAX(value, 0) / quantum * quantum;
+}
+
+/*
+ * Step the shown value towards the last raw one. Returns true when it
+ * changed; leaves `pending` set when only the hold kept it from changing.
+ */
+static bool settle(struct stabiliser *s, int64_t now) {
+    int32_t target = quantise(s, s->raw);
+    bool rising = target > s->shown;
+
+    s->pending = false;
+    if (target == s->shown) {
+        return false;
+    }
+
+    /* Turning back needs the raw value to clear the step boundary by the hysteresis */
+    if (rising != s->rising) {
+        int32_t cleared = quantise(s, rising ? s->raw - s->config.hysteresis
+                                             : s->raw + s->config.hysteresis);
+        if (rising ? cleared <= s->shown : cleared >= s->shown) {
+            return false;
+        }
+    }
+
+    if (now < s->changed_at + s->config.hold_ms) {
+        s->pending = true;
+        return false;
+    }
+
+    s->shown = target;
+    s->rising = rising;
+    s->changed_at = now;
+    s->changes++;
+    LOG_DBG("Stabilised %s now %d, %u of %u updates shown", s->name, s->shown, s->changes,
+            s->updates);
+    return true;
+}
+
+static void schedule_recheck(void) {
+    struct stabiliser *s;
+    int64_t deadline = INT64_MAX;
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&stabilisers, s, node) {
+        if (s->pending) {
+            deadline = MIN(deadline, s->changed_at + s->config.hold_ms);
+        }
+    }
+
+    if (deadline == INT64_MAX) {
+        k_work_cancel_delayable(&recheck_work);
+    } else {
+        k_work_reschedule_for_queue(zmk_display_work_q(), &recheck_work,
+                                    K_TIMEOUT_ABS_MS(deadline));
+    }
+}
+
+static void recheck_work_cb(struct k_work *work) {
+    struct stabiliser *s;
+    int64_t now = k_uptime_get();
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK)
+    if (nice_view_is_parked()) {
+        return;
+    }
+#endif
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&stabilisers, s, node) {
+        if (s->pending && settle(s, now)) {
+            s->apply(s);
+        }
+    }
+
+    schedule_recheck();
+}
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK)
+/* Late values wait for wake rather than waking the CPU */
+static void stabilise_park(struct nice_view_park_hook *hook) {
+    k_work_cancel_delayable(&recheck_work);
+}
+
+static void stabilise_resume(struct nice_view_park_hook *hook) { schedule_recheck(); }
+
+static struct nice_view_park_hook park_hook = {
+    .park = stabilise_park,
+    .resume = stabilise_resume,
+};
+#endif
+
+void stabiliser_update(struct stabiliser *s, int32_t raw) {
+    int64_t now = k_uptime_get();
+
+    if (s->updates == 0) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PARK)
+        if (sys_slist_is_empty(&stabilisers)) {
+            nice_view_park_hook_register(&park_hook);
+        }
+#endif
+        sys_slist_append(&stabilisers, &s->node);
+    }
+
+    /* Trace line for scripts/stabilise_replay.py */
+    LOG_DBG("stabilise %s %d %u", s->name, raw, (uint32_t)now);
+    s->raw = raw;
+    s->updates++;
+
+    if (!s->valid) {
+        s->valid = true;
+        s->pending = false;
+        s->shown = quantise(s, raw);
+        s->changed_at = now;
+        s->changes++;
+        s->apply(s);
+    } else if (settle(s, now)) {
+        s->apply(s);
+    }
+
+    schedule_recheck();
+}
+
+void stabiliser_reset(struct stabiliser *s) { s->valid = false; }
@@ -0,0 +1,48 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/*
+ * Sits between a ZMK event and the status state a widget draws from, so that
+ * jitter in a value does not turn into renders. A new value is shown when it
+ * lands in another `quantum`-sized step; turning back against the previous
+ * change needs `hysteresis` more. Once shown, a value stays up for at least
+ * `hold_ms`; a change in that time is shown late, when the hold runs out.
+ */
+struct stabiliser_config {
+    uint16_t quantum;
+    uint16_t hysteresis;
+    uint32_t hold_ms;
+};
+
+struct stabiliser {
+    const char *name;
+    struct stabiliser_config config;
+    /* Copies `shown` into the status state and notifies; display work queue */
+    void (*apply)(struct stabiliser *stabiliser);
+
+    /* Bookkeeping, zero-initialise */
+    sys_snode_t node;
+    bool valid;
+    bool pending;
+    bool rising;
+    int32_t raw;
+    int32_t shown;
+    int64_t changed_at;
+    /* Raw updates seen and how many of them changed the display */
+    uint32_t updates;
+    uint32_t changes;
+};
+
+/* Feed a raw value; calls apply() now or later if the shown value changes. Display work queue. */
+void stabiliser_update(struct stabiliser *stabiliser, int32_t raw);
+
+/* Show the next update straight away, e.g. after the value's source changed */
+void stabiliser_reset(struct stabiliser *stabiliser);
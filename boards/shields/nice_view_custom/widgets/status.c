@@ -13,6 +13,12 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/battery.h>
 #include <zmk/display.h>
 #include "status.h"
+#include "scheduler.h"
+#include "clock.h"
+#include "host_text.h"
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+#include "stabilise.h"
+#endif
 #include <zmk/events/usb_conn_state_changed.h>
 #include <zmk/event_manager.h>
 #include <zmk/events/battery_state_changed.h>
@@ -44,6 +50,14 @@ struct wpm_status_state {
     uint8_t wpm;
 };
 
+/* The WPM graph gives its top rows to the clock when that is shown */
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_CLOCK)
+#define WPM_GRAPH_TOP (CLOCK_Y + CLOCK_HEIGHT + 3)
+#else
+#define WPM_GRAPH_TOP 24
+#endif
+#define WPM_GRAPH_BOTTOM 60
+
 static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
     lv_obj_t *canvas = lv_obj_get_child(widget, 0);
 
@@ -51,15 +65,11 @@ static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_st
     init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_16, LV_TEXT_ALIGN_RIGHT);
     lv_draw_label_dsc_t label_dsc_wpm;
     init_label_dsc(&label_dsc_wpm, LVGL_FOREGROUND, &lv_font_unscii_8, LV_TEXT_ALIGN_RIGHT);
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
     lv_draw_line_dsc_t line_dsc;
     init_line_dsc(&line_dsc, LVGL_FOREGROUND, 1);
 
-    // Fill background
-    lv_canvas_draw_rect(canvas, 0, 0, CANVAS_SIZE, CANVAS_SIZE, &rect_black_dsc);
+    // Background with battery outline and WPM box
+    draw_background(cbuf, background_top);
 
     // Draw battery
     draw_battery(canvas, state);
@@ -87,9 +97,6 @@ static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_st
     lv_canvas_draw_text(canvas, 0, 0, CANVAS_SIZE, &label_dsc, output_text);
 
     // Draw WPM
-    lv_canvas_draw_rect(canvas, 0, 21, 68, 42, &rect_white_dsc);
-    lv_canvas_draw_rect(canvas, 1, 22, 66, 40, &rect_black_dsc);
-
     char wpm_text[6] = {};
     snprintf(wpm_text, sizeof(wpm_text), "%d", state->wpm[9]);
     lv_canvas_draw_text(canvas, 42, 52, 24, &label_dsc_wpm, wpm_text);
@@ -114,23 +121,22 @@ static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_st
     lv_point_t points[10];
     for (int i = 0; i < 10; i++) {
         points[i].x = 2 + i * 7;
-        points[i].y = 60 - (state->wpm[i] - min) * 36 / range;
+        points[i].y =
+            WPM_GRAPH_BOTTOM - (state->wpm[i] - min) * (WPM_GRAPH_BOTTOM - WPM_GRAPH_TOP) / range;
     }
     lv_canvas_draw_line(canvas, points, 10, &line_dsc);
 
     // Rotate canvas
     rotate_canvas(canvas, cbuf);
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_CLOCK)
+    clock_draw();
+#endif
 }
 
 static void draw_middle(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
     lv_obj_t *canvas = lv_obj_get_child(widget, 1);
 
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
-    lv_draw_arc_dsc_t arc_dsc;
-    init_arc_dsc(&arc_dsc, LVGL_FOREGROUND, 2);
     lv_draw_arc_dsc_t arc_dsc_filled;
     init_arc_dsc(&arc_dsc_filled, LVGL_FOREGROUND, 9);
     lv_draw_label_dsc_t label_dsc;
@@ -138,10 +144,10 @@ static void draw_middle(lv_obj_t *widget, lv_color_t cbuf[], const struct status
     lv_draw_label_dsc_t label_dsc_black;
     init_label_dsc(&label_dsc_black, LVGL_BACKGROUND, &lv_font_montserrat_18, LV_TEXT_ALIGN_CENTER);
 
-    // Fill background
-    lv_canvas_draw_rect(canvas, 0, 0, CANVAS_SIZE, CANVAS_SIZE, &rect_black_dsc);
+    // Background with the profile rings
+    draw_background(cbuf, background_middle);
 
-    // Draw circles
+    // Draw selection and labels
     int circle_offsets[5][2] = {
         {13, 13}, {55, 13}, {34, 34}, {13, 55}, {55, 55},
     };
@@ -149,9 +155,6 @@ static void draw_middle(lv_obj_t *widget, lv_color_t cbuf[], const struct status
     for (int i = 0; i < 5; i++) {
         bool selected = i == state->active_profile_index;
 
-        lv_canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 13, 0, 360,
-                           &arc_dsc);
-
         if (selected) {
             lv_canvas_draw_arc(canvas, circle_offsets[i][0], circle_offsets[i][1], 9, 0, 359,
                                &arc_dsc_filled);
@@ -167,46 +170,102 @@ static void draw_middle(lv_obj_t *widget, lv_color_t cbuf[], const struct status
     rotate_canvas(canvas, cbuf);
 }
 
-static void draw_bottom(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 2);
+static void draw_bottom(struct zmk_widget_status *widget, const struct status_state *state) {
+    lv_obj_t *canvas = lv_obj_get_child(widget->obj, 2);
+    const char *label = state->layer_label;
+    bool scrolling = false;
+    char text[10] = {};
 
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
     lv_draw_label_dsc_t label_dsc;
     init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_14, LV_TEXT_ALIGN_CENTER);
 
     // Fill background
-    lv_canvas_draw_rect(canvas, 0, 0, CANVAS_SIZE, CANVAS_SIZE, &rect_black_dsc);
+    draw_background(widget->cbuf3, NULL);
 
-    // Draw layer
-    if (state->layer_label == NULL) {
-        char text[10] = {};
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_HOST_TEXT)
+    // Host text takes the band while there is any, except just after a layer change
+    if (host_text_get() != NULL) {
+        label = host_text_get();
+    }
+#endif
 
+    // Draw layer
+    if (label == NULL) {
         sprintf(text, "LAYER %i", state->layer_index);
+        label = text;
+    }
 
-        lv_canvas_draw_text(canvas, 0, 5, 68, &label_dsc, text);
-    } else {
-        lv_canvas_draw_text(canvas, 0, 5, 68, &label_dsc, state->layer_label);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_MARQUEE)
+    // Labels wider than the box scroll instead of being clipped
+    scrolling = marquee_set_text(&widget->layer_marquee, label);
+#endif
+
+    if (!scrolling) {
+        lv_canvas_draw_text(canvas, 0, 5, 68, &label_dsc, label);
     }
 
     // Rotate canvas
-    rotate_canvas(canvas, cbuf);
+    rotate_canvas(canvas, widget->cbuf3);
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_MARQUEE)
+    if (scrolling) {
+        marquee_draw(&widget->layer_marquee);
+    }
+#endif
 }
 
-static void set_battery_status(struct zmk_widget_status *widget,
+/* Returns true when the charging flag changed */
+static bool set_battery_status(struct zmk_widget_status *widget,
                                struct battery_status_state state) {
+    bool changed = false;
+
 #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+    changed = widget->state.charging != state.usb_present;
     widget->state.charging = state.usb_present;
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
 
+#if !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
     widget->state.battery = state.level;
+#endif
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    return changed;
 }
 
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+static void apply_battery_level(struct stabiliser *stabiliser) {
+    struct zmk_widget_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        widget->state.battery = stabiliser->shown;
+    }
+    nice_view_widgets_notify(NICE_VIEW_INPUT_BATTERY);
+}
+
+static struct stabiliser battery_level = {
+    .name = "battery",
+    .config =
+        {
+            .quantum = CONFIG_NICE_VIEW_WIDGET_STABILISE_BATTERY_QUANTUM,
+            .hysteresis = CONFIG_NICE_VIEW_WIDGET_STABILISE_BATTERY_HYSTERESIS,
+            .hold_ms = CONFIG_NICE_VIEW_WIDGET_STABILISE_BATTERY_HOLD_MS,
+        },
+    .apply = apply_battery_level,
+};
+#endif
+
 static void battery_status_update_cb(struct battery_status_state state) {
     struct zmk_widget_status *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_battery_status(widget, state); }
+    bool changed = !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE);
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        changed |= set_battery_status(widget, state);
+    }
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+    stabiliser_update(&battery_level, state.level);
+#endif
+
+    if (changed) {
+        nice_view_widgets_notify(NICE_VIEW_INPUT_BATTERY);
+    }
 }
 
 static struct battery_status_state battery_status_get_state(const zmk_event_t *eh) {
@@ -228,20 +287,61 @@ ZMK_SUBSCRIPTION(widget_battery_status, zmk_battery_state_changed);
 ZMK_SUBSCRIPTION(widget_battery_status, zmk_usb_conn_state_changed);
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
 
-static void set_output_status(struct zmk_widget_status *widget,
+/* Returns true when anything but the connection flag changed */
+static bool set_output_status(struct zmk_widget_status *widget,
                               const struct output_status_state *state) {
+    bool changed =
+        !zmk_endpoint_instance_eq(widget->state.selected_endpoint, state->selected_endpoint) ||
+        widget->state.active_profile_index != state->active_profile_index ||
+        widget->state.active_profile_bonded != state->active_profile_bonded;
+
     widget->state.selected_endpoint = state->selected_endpoint;
     widget->state.active_profile_index = state->active_profile_index;
+#if !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
     widget->state.active_profile_connected = state->active_profile_connected;
+#endif
     widget->state.active_profile_bonded = state->active_profile_bonded;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
-    draw_middle(widget->obj, widget->cbuf2, &widget->state);
+    return changed;
+}
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+static void apply_connection(struct stabiliser *stabiliser) {
+    struct zmk_widget_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        widget->state.active_profile_connected = stabiliser->shown;
+    }
+    nice_view_widgets_notify(NICE_VIEW_INPUT_OUTPUT);
 }
 
+static struct stabiliser connection = {
+    .name = "connection",
+    .config = {.quantum = 1, .hold_ms = CONFIG_NICE_VIEW_WIDGET_STABILISE_CONNECTION_HOLD_MS},
+    .apply = apply_connection,
+};
+
+static int connection_profile = -1;
+#endif
+
 static void output_status_update_cb(struct output_status_state state) {
     struct zmk_widget_status *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_output_status(widget, &state); }
+    bool changed = !IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE);
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        changed |= set_output_status(widget, &state);
+    }
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+    /* Another profile's connection state is news, not jitter */
+    if (state.active_profile_index != connection_profile) {
+        connection_profile = state.active_profile_index;
+        stabiliser_reset(&connection);
+    }
+    stabiliser_update(&connection, state.active_profile_connected);
+#endif
+
+    if (changed) {
+        nice_view_widgets_notify(NICE_VIEW_INPUT_OUTPUT);
+    }
 }
 
 static struct output_status_state output_status_get_state(const zmk_event_t *_eh) {
@@ -267,13 +367,15 @@ ZMK_SUBSCRIPTION(widget_output_status, zmk_ble_active_profile_changed);
 static void set_layer_status(struct zmk_widget_status *widget, struct layer_status_state state) {
     widget->state.layer_index = state.index;
     widget->state.layer_label = state.label;
-
-    draw_bottom(widget->obj, widget->cbuf3, &widget->state);
 }
 
 static void layer_status_update_cb(struct layer_status_state state) {
     struct zmk_widget_status *widget;
     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_layer_status(widget, state); }
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_HOST_TEXT)
+    host_text_show_layer();
+#endif
+    nice_view_widgets_notify(NICE_VIEW_INPUT_LAYER);
 }
 
 static struct layer_status_state layer_status_get_state(const zmk_event_t *eh) {
@@ -291,14 +393,38 @@ static void set_wpm_status(struct zmk_widget_status *widget, struct wpm_status_s
         widget->state.wpm[i] = widget->state.wpm[i + 1];
     }
     widget->state.wpm[9] = state.wpm;
+}
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STABILISE)
+/* The graph gets a new point only when the shown value changes */
+static void apply_wpm(struct stabiliser *stabiliser) {
+    struct wpm_status_state state = {.wpm = stabiliser->shown};
+    struct zmk_widget_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_wpm_status(widget, state); }
+    nice_view_widgets_notify(NICE_VIEW_INPUT_WPM);
 }
 
+static struct stabiliser wpm_value = {
+    .name = "wpm",
+    .config =
+        {
+            .quantum = CONFIG_NICE_VIEW_WIDGET_STABILISE_WPM_QUANTUM,
+            .hysteresis = CONFIG_NICE_VIEW_WIDGET_STABILISE_WPM_HYSTERESIS,
+            .hold_ms = CONFIG_NICE_VIEW_WIDGET_STABILISE_WPM_HOLD_MS,
+        },
+    .apply = apply_wpm,
+};
+
+static void wpm_status_update_cb(struct wpm_status_state state) {
+    stabiliser_update(&wpm_value, state.wpm);
+}
+#else
 static void wpm_status_update_cb(struct wpm_status_state state) {
     struct zmk_widget_status *widget;
     SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_wpm_status(widget, state); }
+    nice_view_widgets_notify(NICE_VIEW_INPUT_WPM);
 }
+#endif
 
 struct wpm_status_state wpm_status_get_state(const zmk_event_t *eh) {
     return (struct wpm_status_state){.wpm = zmk_wpm_get_state()};
@@ -308,6 +434,67 @@ ZMK_DISPLAY_WIDGET_LISTENER(widget_wpm_status, struct wpm_status_state, wpm_stat
                             wpm_status_get_state)
 ZMK_SUBSCRIPTION(widget_wpm_status, zmk_wpm_state_changed);
 
+static void render_top(struct nice_view_widget *region) {
+    struct zmk_widget_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        draw_top(widget->obj, widget->cbuf, &widget->state);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_CHARGING_ANIMATION)
+        charging_anim_update(&widget->charging);
+#endif
+    }
+}
+
+static void render_middle(struct nice_view_widget *region) {
+    struct zmk_widget_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        draw_middle(widget->obj, widget->cbuf2, &widget->state);
+    }
+}
+
+static void render_bottom(struct nice_view_widget *region) {
+    struct zmk_widget_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        draw_bottom(widget, &widget->state);
+    }
+}
+
+static struct nice_view_widget top_region = {
+    .name = "top",
+    .region = {.x1 = 92, .y1 = 0, .x2 = 159, .y2 = 67},
+    .inputs = NICE_VIEW_INPUT_BATTERY | NICE_VIEW_INPUT_OUTPUT | NICE_VIEW_INPUT_WPM,
+    .priority = 2,
+    .budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US,
+    .render = render_top,
+};
+
+static struct nice_view_widget middle_region = {
+    .name = "middle",
+    .region = {.x1 = 24, .y1 = 0, .x2 = 91, .y2 = 67},
+    .inputs = NICE_VIEW_INPUT_OUTPUT,
+    .priority = 1,
+    .budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US,
+    .render = render_middle,
+};
+
+static struct nice_view_widget bottom_region = {
+    .name = "bottom",
+    .region = {.x1 = 0, .y1 = 0, .x2 = 23, .y2 = 67},
+    .inputs = NICE_VIEW_INPUT_LAYER,
+    .priority = 0,
+    .budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US,
+    .render = render_bottom,
+};
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_HOST_TEXT)
+static struct nice_view_widget host_text_region = {
+    .name = "host_text",
+    .region = {.x1 = 0, .y1 = 0, .x2 = 23, .y2 = 67},
+    .priority = 3,
+    .budget_us = CONFIG_NICE_VIEW_WIDGET_SCHED_BUDGET_US,
+    .render = render_bottom,
+};
+#endif
+
 int zmk_widget_status_init(struct zmk_widget_status *widget, lv_obj_t *parent) {
     widget->obj = lv_obj_create(parent);
     lv_obj_set_size(widget->obj, 160, 68);
@@ -320,8 +507,23 @@ int zmk_widget_status_init(struct zmk_widget_status *widget, lv_obj_t *parent) {
     lv_obj_t *bottom = lv_canvas_create(widget->obj);
     lv_obj_align(bottom, LV_ALIGN_TOP_LEFT, -44, 0);
     lv_canvas_set_buffer(bottom, widget->cbuf3, CANVAS_SIZE, CANVAS_SIZE, LV_IMG_CF_TRUE_COLOR);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_MARQUEE)
+    marquee_init(&widget->layer_marquee, "layer", bottom, widget->cbuf3, &lv_font_montserrat_14, 5);
+#endif
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_CHARGING_ANIMATION)
+    charging_anim_init(&widget->charging, top, widget->cbuf, &widget->state);
+#endif
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_CLOCK)
+    clock_init(top, widget->cbuf);
+#endif
 
     sys_slist_append(&widgets, &widget->node);
+    nice_view_widget_register(&top_region);
+    nice_view_widget_register(&middle_region);
+    nice_view_widget_register(&bottom_region);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_HOST_TEXT)
+    host_text_init(&host_text_region);
+#endif
     widget_battery_status_init();
     widget_output_status_init();
     widget_layer_status_init();
@@ -10,6 +10,8 @@
 #include <lvgl.h>
 #include <zephyr/kernel.h>
 #include "util.h"
+#include "charging.h"
+#include "marquee.h"
 
 struct zmk_widget_status {
     sys_snode_t node;
@@ -17,6 +19,12 @@ struct zmk_widget_status {
     lv_color_t cbuf[CANVAS_SIZE * CANVAS_SIZE];
     lv_color_t cbuf2[CANVAS_SIZE * CANVAS_SIZE];
     lv_color_t cbuf3[CANVAS_SIZE * CANVAS_SIZE];
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_MARQUEE)
+    struct marquee layer_marquee;
+#endif
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_CHARGING_ANIMATION)
+    struct charging_anim charging;
+#endif
     struct status_state state;
 };
 
@@ -7,34 +7,54 @@
 
 #include <zephyr/kernel.h>
 #include "util.h"
+#include "bitops.h"
+#include "scratch.h"
+#include "watchdog.h"
 
 LV_IMG_DECLARE(bolt);
 
+/* The canvases hold one byte per pixel, so rotating is a byte transpose */
+BUILD_ASSERT(sizeof(lv_color_t) == 1, "rotate_canvas expects 1-bit colour depth");
+BUILD_ASSERT(CANVAS_SIZE % 4 == 0, "rotate_canvas works on 4x4 blocks");
+SCRATCH_RESERVE("rotate", CANVAS_SIZE * CANVAS_SIZE);
+
 void rotate_canvas(lv_obj_t *canvas, lv_color_t cbuf[]) {
-    static lv_color_t cbuf_tmp[CANVAS_SIZE * CANVAS_SIZE];
-    memcpy(cbuf_tmp, cbuf, sizeof(cbuf_tmp));
-    lv_img_dsc_t img;
-    img.data = (void *)cbuf_tmp;
-    img.header.cf = LV_IMG_CF_TRUE_COLOR;
-    img.header.w = CANVAS_SIZE;
-    img.header.h = CANVAS_SIZE;
-
-    lv_canvas_fill_bg(canvas, LVGL_BACKGROUND, LV_OPA_COVER);
-    lv_canvas_transform(canvas, &img, 900, LV_IMG_ZOOM_NONE, -1, 0, CANVAS_SIZE / 2,
-                        CANVAS_SIZE / 2, true);
+    size_t mark = scratch_mark();
+    lv_color_t *cbuf_tmp = scratch_alloc("rotate", CANVAS_SIZE * CANVAS_SIZE);
+    uint32_t start = render_watchdog_stage_begin();
+
+    if (cbuf_tmp != NULL) {
+        memcpy(cbuf_tmp, cbuf, CANVAS_SIZE * CANVAS_SIZE);
+        bitops_rotate_cw8((uint8_t *)cbuf, (const uint8_t *)cbuf_tmp, CANVAS_SIZE);
+        lv_obj_invalidate(canvas);
+    }
+    render_watchdog_stage_end(RENDER_STAGE_ROTATE, start);
+    scratch_release(mark);
+}
+
+void draw_background(lv_color_t cbuf[], const uint8_t *background) {
+    lv_color_t colors[2] = {LVGL_BACKGROUND, LVGL_FOREGROUND};
+
+    if (background == NULL) {
+        memset(cbuf, colors[0].full, CANVAS_SIZE * CANVAS_SIZE);
+        return;
+    }
+
+    for (int y = 0; y < CANVAS_SIZE; y++) {
+        const uint8_t *row = &background[y * DIV_ROUND_UP(CANVAS_SIZE, 8)];
+        lv_color_t *dst = &cbuf[y * CANVAS_SIZE];
+
+        for (int x = 0; x < CANVAS_SIZE; x++) {
+            dst[x] = colors[(row[x / 8] >> (7 - x % 8)) & 1];
+        }
+    }
 }
 
 void draw_battery(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
     lv_draw_rect_dsc_t rect_white_dsc;
     init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
 
-    lv_canvas_draw_rect(canvas, 0, 2, 29, 12, &rect_white_dsc);
-    lv_canvas_draw_rect(canvas, 1, 3, 27, 10, &rect_black_dsc);
     lv_canvas_draw_rect(canvas, 2, 4, (state->battery + 2) / 4, 8, &rect_white_dsc);
-    lv_canvas_draw_rect(canvas, 30, 5, 3, 6, &rect_white_dsc);
-    lv_canvas_draw_rect(canvas, 31, 6, 1, 4, &rect_black_dsc);
 
     if (state->charging) {
         lv_draw_img_dsc_t img_dsc;
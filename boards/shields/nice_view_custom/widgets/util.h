@@ -10,10 +10,16 @@
 
 #define CANVAS_SIZE 68
 
-#define LVGL_BACKGROUND                                                                            \
-    IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_black() : lv_color_white()
-#define LVGL_FOREGROUND                                                                            \
-    IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_white() : lv_color_black()
+/* Static canvas backgrounds, 1bpp rows MSB first with 1 for foreground (scripts/backgrounds.py) */
+#define CANVAS_BACKGROUND_SIZE (DIV_ROUND_UP(CANVAS_SIZE, 8) * CANVAS_SIZE)
+
+extern const uint8_t background_top[CANVAS_BACKGROUND_SIZE];
+extern const uint8_t background_middle[CANVAS_BACKGROUND_SIZE];
+extern const uint8_t background_battery[CANVAS_BACKGROUND_SIZE];
+
+/* Widgets always draw in this palette; inversion is applied at flush time (see flush.h) */
+#define LVGL_BACKGROUND lv_color_white()
+#define LVGL_FOREGROUND lv_color_black()
 
 struct status_state {
     uint8_t battery;
@@ -39,6 +45,9 @@ struct battery_status_state {
 };
 
 void rotate_canvas(lv_obj_t *canvas, lv_color_t cbuf[]);
+/* Start an unrotated canvas from a static background, or plain background colour for NULL */
+void draw_background(lv_color_t cbuf[], const uint8_t *background);
+/* Battery level and charging bolt; the outline is part of the canvas background */
 void draw_battery(lv_obj_t *canvas, const struct status_state *state);
 void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
                     lv_text_align_t align);
@@ -0,0 +1,160 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+#include "event_ring.h"
+#endif
+#include "watchdog.h"
+
+/*
+ * Everything here runs on the display work queue: the scheduler pass and the
+ * LVGL refresh (through the driver's monitor callback) share that thread, so
+ * no locking is needed.
+ */
+
+static const char *const stage_names[RENDER_STAGE_COUNT] = {
+    [RENDER_STAGE_DRAW] = "draw",
+    [RENDER_STAGE_ROTATE] = "rotate",
+    [RENDER_STAGE_DECODE] = "decode",
+    [RENDER_STAGE_REFRESH] = "refresh",
+};
+
+static struct render_watchdog_stats stats;
+
+static const char *culprit;
+static uint32_t stage_us[RENDER_STAGE_COUNT];
+
+static bool frame_open;
+static uint32_t frame_render_us;
+static const char *frame_culprit;
+static uint32_t frame_culprit_us;
+
+static void (*next_monitor_cb)(lv_disp_drv_t *drv, uint32_t time, uint32_t px);
+
+static void check_frame(uint32_t refresh_us) {
+    uint32_t total = frame_render_us + refresh_us;
+
+    frame_open = false;
+    stats.frames++;
+    stats.worst_frame_us = MAX(stats.worst_frame_us, total);
+
+    if (total > CONFIG_NICE_VIEW_WIDGET_WATCHDOG_FRAME_DEADLINE_US) {
+        stats.frame_overruns++;
+        if (refresh_us >= frame_culprit_us) {
+            stats.stage_overruns[RENDER_STAGE_REFRESH]++;
+            LOG_WRN("Frame overran deadline: %u us > %u us, refresh took %u us", total,
+                    CONFIG_NICE_VIEW_WIDGET_WATCHDOG_FRAME_DEADLINE_US, refresh_us);
+        } else {
+            LOG_WRN("Frame overran deadline: %u us > %u us, widget %s took %u us", total,
+                    CONFIG_NICE_VIEW_WIDGET_WATCHDOG_FRAME_DEADLINE_US, frame_culprit,
+                    frame_culprit_us);
+        }
+    }
+
+    frame_render_us = 0;
+    frame_culprit = NULL;
+    frame_culprit_us = 0;
+}
+
+static void monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px) {
+    check_frame(time * USEC_PER_MSEC);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_EVENT_RING)
+    event_ring_record(EVENT_RING_REFRESH, 0, NULL, time * USEC_PER_MSEC);
+#endif
+
+    if (next_monitor_cb != NULL) {
+        next_monitor_cb(drv, time, px);
+    }
+}
+
+void render_watchdog_init(void) {
+    lv_disp_t *disp = lv_disp_get_default();
+
+    if (disp == NULL || disp->driver->monitor_cb == monitor_cb) {
+        return;
+    }
+
+    next_monitor_cb = disp->driver->monitor_cb;
+    disp->driver->monitor_cb = monitor_cb;
+}
+
+void render_watchdog_frame_begin(void) {
+    /* The previous pass drew nothing LVGL had to refresh */
+    if (frame_open) {
+        check_frame(0);
+    }
+}
+
+void render_watchdog_frame_end(void) { frame_open = frame_render_us > 0; }
+
+void render_watchdog_widget_begin(const char *name) {
+    culprit = name;
+    memset(stage_us, 0, sizeof(stage_us));
+}
+
+bool render_watchdog_widget_end(uint32_t cost_us, uint32_t budget_us) {
+    enum render_stage worst = RENDER_STAGE_DRAW;
+    uint32_t claimed = stage_us[RENDER_STAGE_ROTATE] + stage_us[RENDER_STAGE_DECODE];
+
+    frame_render_us += cost_us;
+    if (cost_us > frame_culprit_us) {
+        frame_culprit = culprit;
+        frame_culprit_us = cost_us;
+    }
+
+    if (budget_us == 0 || cost_us <= budget_us) {
+        return false;
+    }
+
+    stage_us[RENDER_STAGE_DRAW] = cost_us > claimed ? cost_us - claimed : 0;
+    for (int i = 0; i < RENDER_STAGE_COUNT; i++) {
+        if (stage_us[i] > stage_us[worst]) {
+            worst = i;
+        }
+    }
+
+    stats.widget_overruns++;
+    stats.stage_overruns[worst]++;
+    LOG_WRN("Widget %s overran its budget: %u us > %u us, %s took %u us", culprit, cost_us,
+            budget_us, stage_names[worst], stage_us[worst]);
+
+    return true;
+}
+
+void render_watchdog_stage_end(enum render_stage stage, uint32_t start) {
+    stage_us[stage] += k_cyc_to_us_floor32(k_cycle_get_32() - start);
+}
+
+void render_watchdog_get_stats(struct render_watchdog_stats *out) { *out = stats; }
+
+#if IS_ENABLED(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+static int cmd_watchdog(const struct shell *sh, size_t argc, char **argv) {
+    struct render_watchdog_stats snapshot;
+
+    render_watchdog_get_stats(&snapshot);
+    shell_print(sh, "frames %u, %u over the %u us deadline, worst %u us", snapshot.frames,
+                snapshot.frame_overruns, CONFIG_NICE_VIEW_WIDGET_WATCHDOG_FRAME_DEADLINE_US,
+                snapshot.worst_frame_us);
+    shell_print(sh, "widgets over budget %u", snapshot.widget_overruns);
+    for (int i = 0; i < RENDER_STAGE_COUNT; i++) {
+        shell_print(sh, "  %-8s %u", stage_names[i], snapshot.stage_overruns[i]);
+    }
+
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((nice_view), watchdog, NULL, "Frame deadline and widget budget overruns",
+                 cmd_watchdog, 1, 0);
+#endif
@@ -0,0 +1,41 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/* Pipeline stages timed during a frame. DRAW is whatever a render spends outside the others. */
+enum render_stage {
+    RENDER_STAGE_DRAW,
+    RENDER_STAGE_ROTATE,
+    RENDER_STAGE_DECODE,
+    RENDER_STAGE_REFRESH,
+    RENDER_STAGE_COUNT,
+};
+
+struct render_watchdog_stats {
+    uint32_t frames;
+    uint32_t frame_overruns;
+    uint32_t widget_overruns;
+    uint32_t stage_overruns[RENDER_STAGE_COUNT];
+    uint32_t worst_frame_us;
+};
+
+void render_watchdog_init(void);
+
+/* Called by the scheduler around each pass and each widget render */
+void render_watchdog_frame_begin(void);
+void render_watchdog_frame_end(void);
+void render_watchdog_widget_begin(const char *name);
+bool render_watchdog_widget_end(uint32_t cost_us, uint32_t budget_us);
+
+/* Called by render code around the expensive parts of a render */
+static inline uint32_t render_watchdog_stage_begin(void) { return k_cycle_get_32(); }
+void render_watchdog_stage_end(enum render_stage stage, uint32_t start);
+
+void render_watchdog_get_stats(struct render_watchdog_stats *stats);
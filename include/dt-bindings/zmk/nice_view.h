@@ -0,0 +1,15 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#define NV_INV_TOG 0
+#define NV_INV_ON 1
+#define NV_INV_OFF 2
+#define NV_FLIP_TOG 3
+#define NV_FLIP_ON 4
+#define NV_FLIP_OFF 5
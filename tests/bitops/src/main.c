@@ -0,0 +1,144 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/ztest.h>
+
+#include "bitops.h"
+#include "test_rand.h"
+
+/* The canvas rotated by util.c, and the row length reversed by flush.c */
+#define SIZE 68
+#define ROW_BYTES 20
+#define ROUNDS 200
+#define BENCH_RUNS 100
+
+static uint32_t seed;
+static uint8_t src[SIZE * SIZE];
+static uint8_t dst[SIZE * SIZE];
+static uint8_t expected[SIZE * SIZE];
+
+static void fill_random(uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = test_rand32(&seed);
+    }
+}
+
+/* dst[r][c] = src[size - 1 - c][r], one pixel at a time */
+static void naive_rotate_cw8(uint8_t *out, const uint8_t *in, size_t size) {
+    for (size_t r = 0; r < size; r++) {
+        for (size_t c = 0; c < size; c++) {
+            out[r * size + c] = in[(size - 1 - c) * size + r];
+        }
+    }
+}
+
+/* Pixel p is bit p % 8 of byte p / 8; pixel p moves to len * 8 - 1 - p */
+static void naive_reverse_row(uint8_t *out, const uint8_t *in, size_t len) {
+    size_t bits = len * 8;
+
+    memset(out, 0, len);
+    for (size_t p = 0; p < bits; p++) {
+        if (in[p / 8] & BIT(p % 8)) {
+            out[(bits - 1 - p) / 8] |= BIT((bits - 1 - p) % 8);
+        }
+    }
+}
+
+static uint32_t naive_rbit32(uint32_t v) {
+    uint32_t r = 0;
+
+    for (int i = 0; i < 32; i++) {
+        r |= ((v >> i) & 1) << (31 - i);
+    }
+    return r;
+}
+
+static void before(void *fixture) {
+    ARG_UNUSED(fixture);
+
+    seed = TEST_RAND_SEED;
+}
+
+ZTEST_SUITE(bitops, NULL, NULL, before, NULL, NULL);
+
+ZTEST(bitops, test_rbit_variants_agree) {
+    static const uint32_t edges[] = {0, 1, 0x80000000, 0xFFFFFFFF, 0x0F0F0F0F, 0x12345678};
+
+    for (size_t i = 0; i < ARRAY_SIZE(edges) + 100000; i++) {
+        uint32_t v = i < ARRAY_SIZE(edges) ? edges[i] : test_rand32(&seed);
+        uint32_t want = naive_rbit32(v);
+
+        zassert_equal(bitops_rbit32(v), want, "rbit32(0x%08x)", v);
+        zassert_equal(bitops_rbit32_generic(v), want, "rbit32_generic(0x%08x)", v);
+        zassert_equal(bitops_rbit_bytes(v), bitops_rev32(want), "rbit_bytes(0x%08x)", v);
+    }
+}
+
+ZTEST(bitops, test_rotate_matches_reference) {
+    for (size_t size = 4; size <= SIZE; size += 4) {
+        for (int round = 0; round < ROUNDS / 10; round++) {
+            fill_random(src, size * size);
+            naive_rotate_cw8(expected, src, size);
+            bitops_rotate_cw8(dst, src, size);
+            zassert_mem_equal(dst, expected, size * size, "size %zu round %d", size, round);
+        }
+    }
+}
+
+ZTEST(bitops, test_reverse_row_matches_reference) {
+    uint8_t row[SIZE];
+
+    for (size_t len = 4; len <= sizeof(row); len += 4) {
+        for (int round = 0; round < ROUNDS; round++) {
+            fill_random(row, len);
+            naive_reverse_row(expected, row, len);
+            bitops_reverse_row(row, len);
+            zassert_mem_equal(row, expected, len, "len %zu round %d", len, round);
+        }
+    }
+}
+
+/*
+ * Cycle counts of the kernels against the per-pixel references. Meaningful on
+ * qemu_cortex_m3, where QEMU counts instructions; native_sim has no cycle
+ * counter worth reading, so there it only shows the kernels run.
+ */
+ZTEST(bitops, test_benchmark) {
+    uint8_t row[ROW_BYTES];
+    uint32_t start, rotate, rotate_naive, reverse, reverse_naive;
+
+    fill_random(src, sizeof(src));
+    fill_random(row, sizeof(row));
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < BENCH_RUNS; i++) {
+        bitops_rotate_cw8(dst, src, SIZE);
+    }
+    rotate = (k_cycle_get_32() - start) / BENCH_RUNS;
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < BENCH_RUNS; i++) {
+        naive_rotate_cw8(expected, src, SIZE);
+    }
+    rotate_naive = (k_cycle_get_32() - start) / BENCH_RUNS;
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < BENCH_RUNS; i++) {
+        bitops_reverse_row(row, sizeof(row));
+    }
+    reverse = (k_cycle_get_32() - start) / BENCH_RUNS;
+
+    start = k_cycle_get_32();
+    for (int i = 0; i < BENCH_RUNS; i++) {
+        naive_reverse_row(expected, row, sizeof(row));
+    }
+    reverse_naive = (k_cycle_get_32() - start) / BENCH_RUNS;
+
+    TC_PRINT("rotate %dx%d: %u cycles (reference %u)\n", SIZE, SIZE, rotate, rotate_naive);
+    TC_PRINT("reverse %d byte row: %u cycles (reference %u)\n", ROW_BYTES, reverse,
+             reverse_naive);
+}
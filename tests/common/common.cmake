@@ -0,0 +1,4 @@
+# Shared by the test apps: where the shield sources live and the deterministic rand
+set(NICE_VIEW_WIDGETS ${CMAKE_CURRENT_LIST_DIR}/../../boards/shields/nice_view_custom/widgets)
+
+target_include_directories(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/include ${NICE_VIEW_WIDGETS})
@@ -0,0 +1,23 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define TEST_RAND_SEED 0x2545F491
+
+/* xorshift32: the same sequence on every platform and every run */
+static inline uint32_t test_rand32(uint32_t *state) {
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
@@ -0,0 +1,126 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/ztest.h>
+
+#include "slideshow.h"
+#include "test_rand.h"
+
+#define INTERVAL_MS (60 * 1000)
+#define MINUTES_PER_MONTH (30 * 24 * 60)
+#define SLIDES 7
+
+static uint32_t seed;
+static uint32_t rand_calls;
+
+static uint32_t fake_rand32(void) {
+    rand_calls++;
+    return test_rand32(&seed);
+}
+
+static struct slideshow show;
+
+static void before(void *fixture) {
+    ARG_UNUSED(fixture);
+
+    seed = TEST_RAND_SEED;
+    rand_calls = 0;
+    slideshow_init(&show, SLIDES, INTERVAL_MS, 0, fake_rand32);
+}
+
+ZTEST_SUITE(slideshow, NULL, NULL, before, NULL, NULL);
+
+ZTEST(slideshow, test_deadlines_do_not_drift) {
+    /* Wake up to 5 s late every minute for three months */
+    for (int i = 1; i <= 3 * MINUTES_PER_MONTH; i++) {
+        int64_t now = show.deadline + fake_rand32() % 5000;
+
+        zassert_equal(slideshow_advance_deadline(&show, now), 1, "tick %d", i);
+        zassert_equal(show.deadline, (int64_t)(i + 1) * INTERVAL_MS, "tick %d", i);
+    }
+}
+
+ZTEST(slideshow, test_missed_intervals_are_skipped) {
+    int64_t now = 10 * INTERVAL_MS + INTERVAL_MS / 2;
+
+    zassert_equal(slideshow_advance_deadline(&show, now), 10);
+    zassert_equal(show.deadline, 11 * INTERVAL_MS);
+    zassert_false(slideshow_due(&show, now));
+
+    /* Exactly on a boundary counts as passing it */
+    zassert_equal(slideshow_advance_deadline(&show, show.deadline), 1);
+    zassert_equal(show.deadline, 12 * INTERVAL_MS);
+}
+
+ZTEST(slideshow, test_every_cycle_shows_every_slide) {
+    uint8_t last = SLIDES;
+
+    for (int cycle = 0; cycle < 1000; cycle++) {
+        uint32_t seen = 0;
+
+        for (int i = 0; i < SLIDES; i++) {
+            uint8_t slide = slideshow_next(&show);
+
+            zassert_true(slide < SLIDES, "cycle %d", cycle);
+            zassert_false(seen & BIT(slide), "slide %u twice in cycle %d", slide, cycle);
+            if (i == 0) {
+                zassert_not_equal(slide, last, "cycle %d starts with its predecessor", cycle);
+            }
+            seen |= BIT(slide);
+            last = slide;
+        }
+        zassert_equal(seen, BIT_MASK(SLIDES), "cycle %d", cycle);
+    }
+}
+
+ZTEST(slideshow, test_no_work_before_the_deadline) {
+    int64_t deadline = show.deadline;
+
+    rand_calls = 0;
+    for (int64_t now = 0; now < deadline; now += 997) {
+        zassert_equal(slideshow_advance_deadline(&show, now), 0);
+        zassert_false(slideshow_due(&show, now));
+    }
+    zassert_equal(show.deadline, deadline);
+    zassert_equal(rand_calls, 0);
+}
+
+ZTEST(slideshow, test_resume_after_sleep_does_not_catch_up) {
+    /* Asleep for a month: one advance on wake, then the normal cadence */
+    int64_t now = (int64_t)MINUTES_PER_MONTH * INTERVAL_MS + 1234;
+
+    zassert_true(slideshow_due(&show, now));
+    zassert_equal(slideshow_advance_deadline(&show, now), MINUTES_PER_MONTH);
+    zassert_false(slideshow_due(&show, now));
+    zassert_equal(show.deadline - now, INTERVAL_MS - 1234);
+
+    /* A key-driven advance starts a full interval from the key press */
+    slideshow_restart(&show, now);
+    zassert_equal(show.deadline, now + INTERVAL_MS);
+}
+
+ZTEST(slideshow, test_work_per_tick_is_bounded) {
+    for (int i = 0; i < 100 * SLIDES; i++) {
+        rand_calls = 0;
+        slideshow_next(&show);
+        /* A reshuffle draws count - 1 numbers, plus one to move a repeat away */
+        zassert_true(rand_calls <= SLIDES, "advance %d drew %u numbers", i, rand_calls);
+    }
+}
+
+ZTEST(slideshow, test_degenerate_counts) {
+    slideshow_init(&show, 1, INTERVAL_MS, 0, fake_rand32);
+    for (int i = 0; i < 10; i++) {
+        zassert_equal(slideshow_next(&show), 0);
+    }
+
+    slideshow_init(&show, 0, INTERVAL_MS, 0, fake_rand32);
+    zassert_equal(slideshow_next(&show), 0);
+
+    slideshow_init(&show, SLIDESHOW_MAX_SLIDES + 10, INTERVAL_MS, 0, fake_rand32);
+    zassert_equal(show.count, SLIDESHOW_MAX_SLIDES);
+}